@@ -1,6 +1,9 @@
 #ifndef CLI_HANDLER_HPP
 #define CLI_HANDLER_HPP
 
+#include <string>
+#include <vector>
+
 #include "CLI/CLIOptions.hpp"
 
 /**
@@ -22,6 +25,32 @@ class CLIHandler {
    */
   int quantityArguments;
 
+  /**
+   * @brief Optional arguments given after the file name, in the form
+   * `--name=value` or `--name`.
+   */
+  std::vector<std::string> optionalArguments;
+
+  /**
+   * @brief Threads allowed per hardware thread with `--threads=N`.
+   */
+  static constexpr size_t THREADS_PER_CORE = 4;
+
+  /**
+   * @brief Returns the largest value accepted by `--threads`: THREADS_PER_CORE
+   * times the number of hardware threads.
+   */
+  static size_t maxThreads();
+
+  /**
+   * @brief Parses one optional argument into `options`.
+   * @param argument The argument, in the form `--name=value` or `--name` for
+   * flags.
+   * @return true if the argument is known and its value is valid, false
+   * otherwise.
+   */
+  bool parseOptionalArgument(const std::string &argument);
+
 public:
   /**
    * @brief Constructs a CLIHandler and parses command-line arguments.
@@ -1,9 +1,12 @@
 #ifndef CLI_OPTIONS_HPP
 #define CLI_OPTIONS_HPP
 
+#include <optional>
 #include <string>
 
 #include "Factory/DictionaryType.hpp"
+#include "Utils/Hashing/StringHash.hpp"
+#include "WordFrequencyAnalyzer/CountingEngine.hpp"
 
 /**
  * @struct CLIOptions
@@ -28,6 +31,34 @@ struct CLIOptions {
    * @brief Type of dictionary to be used in the program.
    */
   DictionaryType dictType;
+
+  /**
+   * @brief Number of threads used to count the words (`--threads=N`).
+   */
+  size_t threads = 1;
+
+  /**
+   * @brief How the words are counted (`--engine=upsert` or `--engine=sort`).
+   */
+  CountingEngine engine = CountingEngine::Upsert;
+
+  /**
+   * @brief Whether the dictionary is frozen into a read-only perfect-hash
+   * table once counting finishes (`--freeze`).
+   */
+  bool freeze = false;
+
+  /**
+   * @brief Whether the longest time taken by a single operation is measured
+   * and reported (`--latency`).
+   */
+  bool latency = false;
+
+  /**
+   * @brief The function that hashes the words (`--hash=std|wyhash|xxh3|
+   * crc32c`). When given, it is also timed alone and reported.
+   */
+  std::optional<StringHashFunction> hash;
 };
 
 #endif
\ No newline at end of file
@@ -1,6 +1,10 @@
 #ifndef IDICTIONARY_HPP
 #define IDICTIONARY_HPP
 
+#include <functional>
+#include <utility>
+#include <vector>
+
 #include "Trees/Base/BaseTree.hpp"
 #include "Visitor/IDictionaryVisitor.hpp"
 
@@ -82,6 +86,19 @@ public:
    */
   virtual void printInOrder(std::ostream &out) const = 0;
 
+  /**
+   * @brief Calls a function on every key-value pair of the dictionary.
+   *
+   * The order of the pairs depends on the dictionary (the balanced trees and
+   * the skip list visit them by key). The dictionary must not be modified
+   * during the traversal.
+   *
+   * @param action The function called with each key and value.
+   */
+  virtual void
+  forEach(const std::function<void(const Key &, const Value &)> &action)
+      const = 0;
+
   /**
    * @brief Retrieves the number of comparisons made in the last operation.
    *
@@ -105,6 +122,103 @@ public:
    */
   virtual const Value &operator[](const Key &key) const = 0;
 
+  /**
+   * @brief Adds an amount to the value associated with a key, inserting the
+   * key with a default-constructed value first if it is not present.
+   *
+   * The default implementation is equivalent to `(*this)[key] += amount` and
+   * is not thread-safe. Dictionaries that report isThreadSafe() override it
+   * with an atomic read-modify-write.
+   *
+   * @param key The key whose value is incremented.
+   * @param amount The amount to add.
+   */
+  virtual void increment(const Key &key, const Value &amount) {
+    (*this)[key] += amount;
+  }
+
+  /**
+   * @brief Adds every key-value pair of another dictionary to this one:
+   * keys already present have the other value added to theirs, and the
+   * others are inserted.
+   *
+   * The default implementation calls increment() on each pair of `other`.
+   * When `other` is this dictionary, the pairs are copied out first, since
+   * an increment may restructure the storage being walked. Dictionaries
+   * override it with faster paths when `other` is of their own type, falling
+   * back to this one otherwise.
+   *
+   * @param other The dictionary to merge from. It is not modified, unless it
+   * is this dictionary, and must not be modified by others during the merge.
+   */
+  virtual void mergeFrom(const IDictionary<Key, Value> &other) {
+    if (&other == this) {
+      std::vector<std::pair<Key, Value>> pairs;
+      forEach([&pairs](const Key &key, const Value &value) {
+        pairs.emplace_back(key, value);
+      });
+
+      for (const auto &[key, value] : pairs)
+        increment(key, value);
+      return;
+    }
+
+    other.forEach([this](const Key &key, const Value &value) {
+      increment(key, value);
+    });
+  }
+
+  /**
+   * @brief Merges another dictionary into this one, like the const overload,
+   * but may take the contents of `other` instead of copying them.
+   *
+   * The default implementation copies. Dictionaries that can splice the
+   * nodes of their own type in override it.
+   *
+   * @param other The dictionary to merge from. It is left in a valid but
+   * unspecified state, possibly empty with its counters reset.
+   */
+  virtual void mergeFrom(IDictionary<Key, Value> &&other) {
+    mergeFrom(static_cast<const IDictionary<Key, Value> &>(other));
+  }
+
+  /**
+   * @brief Prepares the dictionary to hold at least `n` keys without growing
+   * again.
+   *
+   * Hash tables resize to fit `n` keys at their maximum load factor, and
+   * pooled structures set aside room for their nodes. The default
+   * implementation does nothing, which suits structures that grow one node
+   * at a time, such as trees. A dictionary never shrinks on a reserve.
+   *
+   * @param n The number of keys to make room for.
+   */
+  virtual void reserve(size_t n) { (void)n; }
+
+  /**
+   * @brief Gives back the memory the dictionary holds beyond what its keys
+   * need, such as the room left by removed keys.
+   *
+   * Hash tables shrink to the smallest size that fits their keys under their
+   * maximum load factor and drop their deleted-slot marks. The default
+   * implementation does nothing, which suits structures that free each node
+   * as it is removed.
+   */
+  virtual void shrinkToFit() {}
+
+  /**
+   * @brief Tells whether increment() and find() may be called from several
+   * threads at once.
+   *
+   * The references returned by operator[] are not covered: a dictionary that
+   * keeps them valid under concurrent writes says so in its own
+   * documentation.
+   *
+   * @return true if the dictionary supports concurrent access; false
+   * otherwise.
+   */
+  virtual bool isThreadSafe() const { return false; }
+
   /**
    * @brief Virtual destructor.
    */
@@ -129,7 +243,7 @@ public:
   friend class BaseTree;
 
   template <typename HashTable, typename Collection, typename K, typename V,
-            typename Hash>
+            typename Hash, typename SizingPolicy>
   friend class BaseHashTable;
 };
 
@@ -13,7 +13,7 @@
  *
  * Expected format:
  * @code
- * freq [tipo] [nome_arquivo.txt]
+ * freq [tipo] [nome_arquivo.txt] [--threads=N] [--engine=upsert|sort] [--freeze] [--latency] [--hash=std|wyhash|xxh3|crc32c]
  * @endcode
  *
  * Supported dictionary types:
@@ -21,6 +21,22 @@
  * - dictionary_redblack
  * - dictionary_chained
  * - dictionary_open
+ * - dictionary_hat
+ * - dictionary_tst
+ * - dictionary_skiplist
+ * - dictionary_splay
+ * - dictionary_treap
+ * - dictionary_countmin
+ * - dictionary_spacesaving
+ * - dictionary_sharded_chained
+ * - dictionary_sharded_open
+ * - dictionary_lockfree
+ * - dictionary_extendible
+ * - dictionary_chained_fastprime
+ * - dictionary_chained_pow2
+ * - dictionary_open_linear
+ * - dictionary_open_double
+ * - dictionary_open_simd
  */
 class ArgumentsInvalidException : public std::invalid_argument {
 public:
@@ -29,12 +45,42 @@ public:
      */
     explicit ArgumentsInvalidException() : std::invalid_argument(std::string("Argumentos inválidos!\n")
               + "O comando deve ser dado na seguinte forma:\n"
-              + "freq [tipo] [nome_arquivo.txt]\n"
+              + "freq [tipo] [nome_arquivo.txt] [--threads=N] [--engine=upsert|sort] [--freeze] [--latency] [--hash=std|wyhash|xxh3|crc32c]\n"
               + "As opções disponíveis são: \n"
               + "dictionary_avl\n"
               + "dictionary_redblack\n"
               + "dictionary_chained\n"
-              + "dictionary_open") {}
+              + "dictionary_open\n"
+              + "dictionary_hat\n"
+              + "dictionary_tst\n"
+              + "dictionary_skiplist\n"
+              + "dictionary_splay\n"
+              + "dictionary_treap\n"
+              + "dictionary_countmin\n"
+              + "dictionary_spacesaving\n"
+              + "dictionary_sharded_chained\n"
+              + "dictionary_sharded_open\n"
+              + "dictionary_lockfree\n"
+              + "dictionary_extendible\n"
+              + "dictionary_chained_fastprime\n"
+              + "dictionary_chained_pow2\n"
+              + "dictionary_open_linear\n"
+              + "dictionary_open_double\n"
+              + "dictionary_open_simd\n"
+              + "Com --threads=N, estruturas concorrentes (dictionary_skiplist,\n"
+              + "dictionary_sharded_*, dictionary_lockfree) são preenchidas\n"
+              + "por N threads; nas demais, cada thread preenche uma estrutura\n"
+              + "própria, e as estruturas são fundidas ao final. N vai de 1\n"
+              + "a 4 vezes o número de threads do processador.\n"
+              + "Com --engine=sort, as palavras são contadas por ordenação\n"
+              + "antes de serem inseridas na estrutura.\n"
+              + "Com --freeze, a estrutura é congelada em uma tabela hash\n"
+              + "perfeita somente leitura ao fim da contagem.\n"
+              + "Com --latency, o tempo de cada operação de uma contagem\n"
+              + "sequencial é medido, e o maior deles é relatado.\n"
+              + "Com --hash=NOME, as palavras são espalhadas pela função de\n"
+              + "hash escolhida (std, wyhash, xxh3 ou crc32c), cujo tempo\n"
+              + "por palavra também é medido e relatado.") {}
 };
 
 #endif
\ No newline at end of file
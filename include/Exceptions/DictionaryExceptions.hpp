@@ -0,0 +1,21 @@
+#ifndef DICTIONARY_EXCEPTIONS_HPP
+#define DICTIONARY_EXCEPTIONS_HPP
+
+#include <stdexcept>
+
+/**
+ * @class UnsupportedOperationException
+ * @brief Exception thrown when a dictionary is asked for an operation it cannot
+ * provide.
+ *
+ * This exception is derived from std::logic_error. Approximate dictionaries,
+ * such as sketches, keep estimates instead of the pairs themselves, so they
+ * cannot, for instance, remove a key or hand out a reference to its value.
+ */
+class UnsupportedOperationException : public std::logic_error {
+public:
+  explicit UnsupportedOperationException()
+      : std::logic_error("Operation not supported by this dictionary.") {}
+};
+
+#endif
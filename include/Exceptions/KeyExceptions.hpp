@@ -51,4 +51,19 @@ public:
       : std::runtime_error("Key not found in the dictionary.") {}
 };
 
+/**
+ * @class KeyOrderException
+ * @brief Exception thrown when two dictionaries are concatenated but the keys
+ * of the first are not all smaller than the keys of the second.
+ *
+ * This exception is derived from std::invalid_argument and is used by ordered
+ * dictionaries that join two key ranges without comparing every pair of keys.
+ */
+class KeyOrderException : public std::invalid_argument {
+public:
+  explicit KeyOrderException()
+      : std::invalid_argument(
+            "Key ranges of the joined dictionaries overlap.") {}
+};
+
 #endif
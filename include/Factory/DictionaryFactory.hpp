@@ -1,15 +1,26 @@
 #ifndef DICTIONARY_FACTORY_HPP
 #define DICTIONARY_FACTORY_HPP
 
+#include <algorithm>
 #include <memory>
 
 #include "Dictionary/IDictionary.hpp"
 #include "Exceptions/FactoryExceptions.hpp"
 #include "Factory/DictionaryType.hpp"
 #include "HashTables/Chained/ChainedHashTable.hpp"
+#include "HashTables/Extendible/ExtendibleHashTable.hpp"
+#include "HashTables/LockFree/LockFreeHashTable.hpp"
 #include "HashTables/OpenAddressing/OpenAddressingHashTable.hpp"
+#include "HashTables/Sharded/ConcurrentShardedHashTable.hpp"
+#include "Sketches/CountMin/CountMinSketch.hpp"
+#include "Sketches/SpaceSaving/SpaceSaving.hpp"
+#include "SkipLists/Concurrent/ConcurrentSkipList.hpp"
 #include "Trees/AVL/AVLTree.hpp"
 #include "Trees/RedBlack/RedBlackTree.hpp"
+#include "Trees/Splay/SplayTree.hpp"
+#include "Trees/Treap/Treap.hpp"
+#include "Tries/HAT/HATTrie.hpp"
+#include "Tries/Ternary/TernarySearchTree.hpp"
 
 /**
  * @class DictionaryFactory
@@ -23,6 +34,20 @@
  * @tparam Value The type of the values in the dictionary.
  */
 template <typename Key, typename Value> class DictionaryFactory {
+  /**
+   * @brief Returns the initial size of a hash table expected to hold
+   * `expectedSize` keys without rehashing.
+   *
+   * @param expectedSize The expected number of keys, or zero if unknown.
+   * @param defaultSize The table's own default size.
+   * @param maxLoadFactor The table's maximum load factor.
+   */
+  static size_t tableSizeFor(size_t expectedSize, size_t defaultSize,
+                             float maxLoadFactor) {
+    return std::max(defaultSize,
+                    static_cast<size_t>(expectedSize / maxLoadFactor) + 1);
+  }
+
 public:
   /**
    * @brief Creates a dictionary instance based on the specified type.
@@ -37,22 +62,97 @@ public:
    * - "dictionary_redblack"
    * - "dictionary_chained"
    * - "dictionary_open"
+   * - "dictionary_hat"
+   * - "dictionary_tst"
+   * - "dictionary_skiplist"
+   * - "dictionary_splay"
+   * - "dictionary_treap"
+   * - "dictionary_countmin"
+   * - "dictionary_spacesaving"
+   * - "dictionary_sharded_chained"
+   * - "dictionary_sharded_open"
+   * - "dictionary_lockfree"
+   * - "dictionary_extendible"
+   * - "dictionary_chained_fastprime"
+   * - "dictionary_chained_pow2"
+   * - "dictionary_open_linear"
+   * - "dictionary_open_double"
+   * - "dictionary_open_simd"
+   * @param expectedSize The expected number of distinct keys, used to size
+   * hash tables up front so that they never rehash while being filled. Zero
+   * keeps the default sizes.
    * @return IDictionary<Key, Value>* A pointer to the newly created dictionary
    * instance. The caller is responsible for deleting this object.
    * @throw DictionaryTypeNotFoundException If the `dictType` does not match any
    * known type.
    */
   static std::unique_ptr<IDictionary<Key, Value>>
-  createDictionary(DictionaryType dictType) {
+  createDictionary(DictionaryType dictType, size_t expectedSize = 0) {
+    const size_t shards = ConcurrentShardedHashTable<
+        Key, Value, ChainedHashTable<Key, Value>>::DEFAULT_SHARDS;
+
     switch (dictType) {
     case DictionaryType::AVL:
       return std::make_unique<AVLTree<Key, Value>>();
     case DictionaryType::RedBlack:
       return std::make_unique<RedBlackTree<Key, Value>>();
     case DictionaryType::Chained:
-      return std::make_unique<ChainedHashTable<Key, Value>>();
+      return std::make_unique<ChainedHashTable<Key, Value>>(
+          tableSizeFor(expectedSize, 7, 1.0f), 1.0f);
     case DictionaryType::OpenAddressing:
-      return std::make_unique<OpenAddressingHashTable<Key, Value>>();
+      return std::make_unique<OpenAddressingHashTable<Key, Value>>(
+          tableSizeFor(expectedSize, 8, 0.7f), 0.7f);
+    case DictionaryType::HATTrie:
+      return std::make_unique<HATTrie<Key, Value>>();
+    case DictionaryType::TernarySearch:
+      return std::make_unique<TernarySearchTree<Key, Value>>();
+    case DictionaryType::ConcurrentSkipList:
+      return std::make_unique<ConcurrentSkipList<Key, Value>>();
+    case DictionaryType::Splay:
+      return std::make_unique<SplayTree<Key, Value>>();
+    case DictionaryType::Treap:
+      return std::make_unique<Treap<Key, Value>>();
+    case DictionaryType::CountMinSketch:
+      return std::make_unique<CountMinSketch<Key, Value>>();
+    case DictionaryType::SpaceSaving:
+      return std::make_unique<SpaceSaving<Key, Value>>();
+    case DictionaryType::ShardedChained:
+      return std::make_unique<ConcurrentShardedHashTable<
+          Key, Value, ChainedHashTable<Key, Value>>>(
+          shards, tableSizeFor(expectedSize / shards, 7, 1.0f));
+    case DictionaryType::ShardedOpenAddressing:
+      return std::make_unique<ConcurrentShardedHashTable<
+          Key, Value, OpenAddressingHashTable<Key, Value>>>(
+          shards, tableSizeFor(expectedSize / shards, 8, 0.7f));
+    case DictionaryType::LockFree:
+      return std::make_unique<LockFreeHashTable<Key, Value>>(
+          tableSizeFor(expectedSize,
+                       LockFreeHashTable<Key, Value>::DEFAULT_CAPACITY, 0.5f));
+    case DictionaryType::Extendible:
+      return std::make_unique<ExtendibleHashTable<Key, Value>>(tableSizeFor(
+          expectedSize, 1,
+          0.7f * ExtendibleHashTable<Key, Value>::DEFAULT_BUCKET_CAPACITY));
+    case DictionaryType::ChainedFastPrime:
+      return std::make_unique<
+          ChainedHashTable<Key, Value, std::hash<Key>, FastPrimeSizing>>(
+          tableSizeFor(expectedSize, 7, 1.0f), 1.0f);
+    case DictionaryType::ChainedPowerOfTwo:
+      return std::make_unique<
+          ChainedHashTable<Key, Value, std::hash<Key>, PowerOfTwoSizing>>(
+          tableSizeFor(expectedSize, 7, 1.0f), 1.0f);
+    case DictionaryType::OpenAddressingLinear:
+      return std::make_unique<
+          OpenAddressingHashTable<Key, Value, std::hash<Key>, LinearProbing>>(
+          tableSizeFor(expectedSize, 8, 0.7f), 0.7f);
+    case DictionaryType::OpenAddressingDouble:
+      return std::make_unique<
+          OpenAddressingHashTable<Key, Value, std::hash<Key>, DoubleHashing>>(
+          tableSizeFor(expectedSize, 8, 0.7f), 0.7f);
+    case DictionaryType::OpenAddressingGroupScan:
+      return std::make_unique<OpenAddressingHashTable<Key, Value,
+                                                      std::hash<Key>,
+                                                      GroupScanProbing>>(
+          tableSizeFor(expectedSize, 8, 0.7f), 0.7f);
     default:
       throw DictionaryTypeNotFoundException();
     }
@@ -8,6 +8,12 @@
  * implementations of the dictionary interface, often used by a factory
  * to determine which object to create.
  */
-enum class DictionaryType { AVL, RedBlack, Chained, OpenAddressing };
+enum class DictionaryType {
+  AVL, RedBlack, Chained, OpenAddressing, HATTrie, TernarySearch,
+  ConcurrentSkipList, Splay, Treap, CountMinSketch, SpaceSaving,
+  ShardedChained, ShardedOpenAddressing, LockFree, Extendible,
+  ChainedFastPrime, ChainedPowerOfTwo, OpenAddressingLinear,
+  OpenAddressingDouble, OpenAddressingGroupScan
+};
 
 #endif
\ No newline at end of file
@@ -5,6 +5,8 @@
 #include <string>
 #include <vector>
 
+#include "Sketches/HyperLogLog/HyperLogLog.hpp"
+
 /**
  * @class FileProcessor
  * @brief Responsible for reading and processing words from a file.
@@ -44,12 +46,16 @@ public:
   std::string path; ///< Full path to the input file.
   std::vector<std::string>
       words; //< Vector containing all normalized words read from the file.
+  HyperLogLog<std::string>
+      vocabulary; ///< Estimate of the number of distinct words, fed while
+                  ///< reading, before any dictionary is built.
 
   /**
    * @brief Constructs a FileProcessor and processes the file.
    *
    * Sets the file path, checks if the file and locale are available,
-   * reads each word from the file, normalizes it, and stores it.
+   * reads each word from the file, normalizes it, stores it and records it in
+   * the vocabulary estimate.
    *
    * @param filename Name of the file to be processed (without path).
    * @throws FileNotFoundException If the file cannot be opened.
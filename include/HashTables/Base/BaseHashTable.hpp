@@ -3,8 +3,22 @@
 
 #include <vector>
 
+#include "HashTables/Base/SizingPolicies.hpp"
+
+/**
+ * @brief Members shared by the hash tables, which derive from it through
+ * CRTP.
+ *
+ * @tparam HashTable The derived hash table.
+ * @tparam Collection The type of each position of the table.
+ * @tparam Key The type of the keys.
+ * @tparam Value The type of the values.
+ * @tparam Hash The hash function.
+ * @tparam SizingPolicy Chooses the sizes of the table and maps hash codes to
+ * positions (see SizingPolicies.hpp).
+ */
 template <typename HashTable, typename Collection, typename Key, typename Value,
-          typename Hash>
+          typename Hash, typename SizingPolicy = PrimeSizing>
 class BaseHashTable {
 protected:
   /**
@@ -39,18 +53,36 @@ protected:
   mutable size_t collisionsCount;
 
   /**
-   * @brief Calculates and returns the next prime number greater than or equal
-   * to a given number.
-   *
-   * This method finds the smallest prime number that is greater than or equal
-   * to the input `num`. It uses a lambda function `isPrime` to efficiently
-   * check for primality. The search starts from `num` (or `num + 1` if `num` is
-   * even) and increments by 2 to only check odd numbers, optimizing the search.
-   *
-   * @param num The starting number from which to find the next prime.
-   * @return The next prime number greater than or equal to `num`.
+   * @brief The storage being emptied by an incremental rehash, or an empty
+   * vector if no rehash is in progress.
+   */
+  std::vector<Collection> oldTable;
+
+  /**
+   * @brief Index of the next collection of `oldTable` to be migrated.
+   */
+  size_t rehashIndex;
+
+  /**
+   * @brief Number of rehashes started.
+   */
+  size_t rehashesCount;
+
+  /**
+   * @brief Number of key-value pairs moved to a new storage by rehashes.
    */
-  size_t getNextPrime(size_t num) const;
+  size_t rehashMovesCount;
+
+  /**
+   * @brief Maps hash codes to positions of `table`.
+   */
+  SizingPolicy sizing;
+
+  /**
+   * @brief Maps hash codes to positions of `oldTable` during an incremental
+   * rehash.
+   */
+  SizingPolicy oldSizing;
 
   /**
    * @brief Checks the current load factor and triggers a rehash if necessary.
@@ -66,10 +98,54 @@ protected:
    * `rehash` method of the derived `HashTable` class (using CRTP) with a new
    * table size that is double the current `tableSize`. This effectively resizes
    * the hash table and redistributes existing elements, improving performance.
+   *
+   * While an incremental rehash is in progress, each call also migrates the
+   * next collections of the old storage (see rehashStep()).
    */
   void checkAndRehash();
 
+  /**
+   * @brief Tells whether an incremental rehash is in progress, i.e. whether
+   * some keys may still be in `oldTable`.
+   */
+  bool isRehashing() const;
+
+  /**
+   * @brief Starts an incremental rehash into a new storage of `size` slots.
+   *
+   * Any rehash still in progress is completed first. The current storage
+   * becomes `oldTable`, and a new empty one takes its place; the keys are
+   * then moved over a few collections at a time by rehashStep(), which
+   * spreads the cost of resizing over the following operations instead of
+   * stalling the one that triggered it.
+   *
+   * @param size The number of slots of the new storage.
+   */
+  void beginRehash(size_t size);
+
+  /**
+   * @brief Migrates the next REHASH_STEP collections of `oldTable` to the
+   * current storage, calling the `migrate` method of the derived class on
+   * each (using CRTP), and releases `oldTable` once all are migrated.
+   *
+   * `migrate` moves the pairs of one collection without comparing keys or
+   * counting collisions, and returns how many it moved, which is added to
+   * `rehashMovesCount` instead.
+   */
+  void rehashStep();
+
+  /**
+   * @brief Migrates every collection still in `oldTable`.
+   */
+  void completeRehash();
+
 public:
+  /**
+   * @brief Number of collections of the old storage migrated by each
+   * operation during an incremental rehash.
+   */
+  static const size_t REHASH_STEP = 4;
+
   /**
    * @brief Constructs a new BaseHashTable object.
    *
@@ -126,6 +202,18 @@ public:
    */
   void incrementCollisionsCount(size_t m = 1) const;
 
+  /**
+   * @brief Returns the number of rehashes started.
+   */
+  size_t getRehashesCount() const;
+
+  /**
+   * @brief Returns the number of key-value pairs moved by rehashes, kept
+   * apart from the comparisons and collisions of the operations on the
+   * table.
+   */
+  size_t getRehashMovesCount() const;
+
   size_t sizeOf() const;
 };
 
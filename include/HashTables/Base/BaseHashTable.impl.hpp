@@ -1,84 +1,123 @@
 #include "HashTables/Base/BaseHashTable.hpp"
 
-#include <cmath>
+template <typename HashTable, typename Collection, typename Key, typename Value,
+          typename Hash, typename SizingPolicy>
+void BaseHashTable<HashTable, Collection, Key, Value, Hash,
+                   SizingPolicy>::checkAndRehash() {
+  if (isRehashing())
+    rehashStep();
+
+  if (getLoadFactor() >= maxLoadFactor)
+    static_cast<HashTable *>(this)->rehash(2 * tableSize);
+}
 
 template <typename HashTable, typename Collection, typename Key, typename Value,
-          typename Hash>
-size_t BaseHashTable<HashTable, Collection, Key, Value, Hash>::getNextPrime(
-    size_t num) const {
-  auto isPrime = [&num](size_t x) -> bool {
-    if (x <= 1)
-      return false;
-    if (x == 2 or x == 3)
-      return true;
-    if (x % 2 == 0)
-      return false;
-
-    for (int i = 3; i <= sqrt(x); i += 2) {
-      if (x % i == 0)
-        return false;
-    }
-
-    return true;
-  };
-
-  size_t candidate;
-  if (num % 2 == 0)
-    candidate = num + 1;
-  else
-    candidate = num + 2;
-  while (true) {
-    if (isPrime(candidate))
-      return candidate;
-    candidate += 2;
-  }
+          typename Hash, typename SizingPolicy>
+bool BaseHashTable<HashTable, Collection, Key, Value, Hash,
+                   SizingPolicy>::isRehashing() const {
+  return !oldTable.empty();
 }
 
 template <typename HashTable, typename Collection, typename Key, typename Value,
-          typename Hash>
-void BaseHashTable<HashTable, Collection, Key, Value, Hash>::checkAndRehash() {
-  if (getLoadFactor() >= maxLoadFactor)
-    static_cast<HashTable *>(this)->rehash(2 * tableSize);
+          typename Hash, typename SizingPolicy>
+void BaseHashTable<HashTable, Collection, Key, Value, Hash,
+                   SizingPolicy>::beginRehash(size_t size) {
+  completeRehash();
+
+  oldTable.swap(table);
+  table = std::vector<Collection>(size);
+  tableSize = size;
+  oldSizing = sizing;
+  sizing.resize(size);
+  rehashIndex = 0;
+  rehashesCount++;
+}
+
+template <typename HashTable, typename Collection, typename Key, typename Value,
+          typename Hash, typename SizingPolicy>
+void BaseHashTable<HashTable, Collection, Key, Value, Hash,
+                   SizingPolicy>::rehashStep() {
+  size_t end = rehashIndex + REHASH_STEP;
+
+  for (; rehashIndex < end and rehashIndex < oldTable.size(); rehashIndex++)
+    rehashMovesCount += static_cast<HashTable *>(this)->migrate(rehashIndex);
+
+  if (rehashIndex == oldTable.size())
+    std::vector<Collection>().swap(oldTable);
+}
+
+template <typename HashTable, typename Collection, typename Key, typename Value,
+          typename Hash, typename SizingPolicy>
+void BaseHashTable<HashTable, Collection, Key, Value, Hash,
+                   SizingPolicy>::completeRehash() {
+  for (; rehashIndex < oldTable.size(); rehashIndex++)
+    rehashMovesCount += static_cast<HashTable *>(this)->migrate(rehashIndex);
+
+  std::vector<Collection>().swap(oldTable);
 }
 
 template <typename HashTable, typename Collection, typename Key, typename Value,
-          typename Hash>
-BaseHashTable<HashTable, Collection, Key, Value, Hash>::BaseHashTable(
-    size_t size, float mlf) {
+          typename Hash, typename SizingPolicy>
+BaseHashTable<HashTable, Collection, Key, Value, Hash,
+              SizingPolicy>::BaseHashTable(size_t size, float mlf) {
   tableSize = size;
   table.resize(tableSize);
+  sizing.resize(tableSize);
   maxLoadFactor = mlf <= 0 ? 0.7 : mlf;
   numberOfElements = 0;
   collisionsCount = 0;
+  rehashIndex = 0;
+  rehashesCount = 0;
+  rehashMovesCount = 0;
 }
 
 template <typename HashTable, typename Collection, typename Key, typename Value,
-          typename Hash>
-float BaseHashTable<HashTable, Collection, Key, Value, Hash>::getLoadFactor()
-    const {
+          typename Hash, typename SizingPolicy>
+float BaseHashTable<HashTable, Collection, Key, Value, Hash,
+                    SizingPolicy>::getLoadFactor() const {
   return static_cast<float>(this->numberOfElements) / this->tableSize;
 }
 
 template <typename HashTable, typename Collection, typename Key, typename Value,
-          typename Hash>
-void BaseHashTable<HashTable, Collection, Key, Value, Hash>::clearHashTable() {
+          typename Hash, typename SizingPolicy>
+void BaseHashTable<HashTable, Collection, Key, Value, Hash,
+                   SizingPolicy>::clearHashTable() {
   table.clear();
   table.resize(tableSize);
+  std::vector<Collection>().swap(oldTable);
+  rehashIndex = 0;
   numberOfElements = 0;
   collisionsCount = 0;
+  rehashesCount = 0;
+  rehashMovesCount = 0;
   static_cast<HashTable *>(this)->resetCounter();
 }
 
 template <typename HashTable, typename Collection, typename Key, typename Value,
-          typename Hash>
-void BaseHashTable<HashTable, Collection, Key, Value,
-                   Hash>::incrementCollisionsCount(size_t amount) const {
+          typename Hash, typename SizingPolicy>
+void BaseHashTable<HashTable, Collection, Key, Value, Hash,
+                   SizingPolicy>::incrementCollisionsCount(
+    size_t amount) const {
   collisionsCount += amount;
 }
 
 template <typename HashTable, typename Collection, typename Key, typename Value,
-          typename Hash>
-size_t BaseHashTable<HashTable, Collection, Key, Value,
-                     Hash>::sizeOf() const {
+          typename Hash, typename SizingPolicy>
+size_t BaseHashTable<HashTable, Collection, Key, Value, Hash,
+                     SizingPolicy>::getRehashesCount() const {
+  return rehashesCount;
+}
+
+template <typename HashTable, typename Collection, typename Key, typename Value,
+          typename Hash, typename SizingPolicy>
+size_t BaseHashTable<HashTable, Collection, Key, Value, Hash,
+                     SizingPolicy>::getRehashMovesCount() const {
+  return rehashMovesCount;
+}
+
+template <typename HashTable, typename Collection, typename Key, typename Value,
+          typename Hash, typename SizingPolicy>
+size_t BaseHashTable<HashTable, Collection, Key, Value, Hash,
+                     SizingPolicy>::sizeOf() const {
   return sizeof(*this) + numberOfElements * sizeof(Collection);
 }
\ No newline at end of file
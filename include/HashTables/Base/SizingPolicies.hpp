@@ -0,0 +1,155 @@
+#ifndef SIZING_POLICIES_HPP
+#define SIZING_POLICIES_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @file SizingPolicies.hpp
+ * @brief Policies that choose the sizes of a hash table and map hash codes to
+ * its buckets.
+ *
+ * A policy provides:
+ * - `static size_t fit(size_t minimum)`: a size the policy supports, for a
+ *   table that should have at least `minimum` buckets.
+ * - `void resize(size_t size)`: prepares the policy for a table of `size`
+ *   buckets.
+ * - `size_t bucket(size_t hash) const`: the bucket of a hash code, in
+ *   [0, size).
+ *
+ * The policy is a template parameter of BaseHashTable, so `bucket` is inlined
+ * into every lookup.
+ */
+
+/**
+ * @class PrimeSizing
+ * @brief Prime sizes found by trial division, with buckets given by `%`.
+ *
+ * This is the original behavior of the chained hash table. Every lookup pays
+ * for a 64-bit division.
+ */
+class PrimeSizing {
+  /**
+   * @brief The number of buckets.
+   */
+  size_t size = 1;
+
+public:
+  /**
+   * @brief Returns the smallest prime greater than `minimum`.
+   */
+  static size_t fit(size_t minimum);
+
+  /**
+   * @brief Sets the number of buckets.
+   */
+  void resize(size_t size);
+
+  /**
+   * @brief Returns `hash % size`.
+   */
+  size_t bucket(size_t hash) const;
+};
+
+/**
+ * @class FastPrimeSizing
+ * @brief Prime sizes taken from a precomputed table, with buckets given by a
+ * division-free modulo.
+ *
+ * The primes grow by about 19% from one to the next (four per doubling).
+ * When the table is resized, the reciprocal of its size is computed once as
+ * a 128-bit fixed-point number M = ceil(2^128 / size). The remainder of a
+ * hash h is then the high 64 bits of (M * h mod 2^128) * size (Lemire,
+ * Kaser and Kurz, "Faster Remainder by Direct Computation"), which takes a
+ * few multiplications instead of a division and is exact for every 64-bit
+ * hash, so the buckets are the same as with `%`.
+ *
+ * Requires a compiler with `unsigned __int128` (GCC or Clang).
+ */
+class FastPrimeSizing {
+  /**
+   * @brief The number of buckets.
+   */
+  uint64_t size = 1;
+
+  /**
+   * @brief ceil(2^128 / size), modulo 2^128.
+   */
+  unsigned __int128 reciprocal = 0;
+
+public:
+  /**
+   * @brief Returns the smallest prime of the table that is at least
+   * `minimum`.
+   *
+   * @throws std::length_error If `minimum` is larger than every prime of the
+   * table.
+   */
+  static size_t fit(size_t minimum);
+
+  /**
+   * @brief Sets the number of buckets and computes its reciprocal.
+   */
+  void resize(size_t size);
+
+  /**
+   * @brief Returns `hash % size`, computed with multiplications.
+   */
+  size_t bucket(size_t hash) const;
+};
+
+/**
+ * @class PowerOfTwoSizing
+ * @brief Power-of-two sizes, with buckets given by Fibonacci hashing.
+ *
+ * The hash code is multiplied by 2^64 divided by the golden ratio, and its
+ * top log2(size) bits are the bucket. The multiplication spreads every bit of
+ * the hash code over the top bits, so that codes differing only in their
+ * high bits, which a mask of the low bits would put in the same bucket, end
+ * up apart.
+ */
+class PowerOfTwoSizing {
+  /**
+   * @brief 64 minus log2 of the number of buckets.
+   */
+  unsigned shift = 63;
+
+public:
+  /**
+   * @brief 2^64 divided by the golden ratio, rounded to an odd number.
+   */
+  static const uint64_t FIBONACCI_MULTIPLIER = 11400714819323198485ULL;
+
+  /**
+   * @brief Returns the smallest power of two that is at least `minimum`,
+   * and at least 2.
+   */
+  static size_t fit(size_t minimum);
+
+  /**
+   * @brief Sets the number of buckets, which must be a power of two of at
+   * least 2.
+   */
+  void resize(size_t size);
+
+  /**
+   * @brief Returns the top bits of `hash` times FIBONACCI_MULTIPLIER.
+   */
+  size_t bucket(size_t hash) const;
+};
+
+inline size_t PrimeSizing::bucket(size_t hash) const { return hash % size; }
+
+inline size_t FastPrimeSizing::bucket(size_t hash) const {
+  unsigned __int128 fraction = reciprocal * hash;
+  unsigned __int128 low = static_cast<uint64_t>(fraction);
+  unsigned __int128 high = fraction >> 64;
+
+  return static_cast<size_t>(((low * size >> 64) + high * size) >> 64);
+}
+
+inline size_t PowerOfTwoSizing::bucket(size_t hash) const {
+  return static_cast<size_t>((hash * FIBONACCI_MULTIPLIER) >> shift);
+}
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef CHAIN_NODE_HPP
+#define CHAIN_NODE_HPP
+
+#include <cstddef>
+#include <utility>
+
+template <typename Key, typename Value>
+/**
+ * @struct ChainNode
+ * @brief Represents a node of a bucket chain in a chained hash table.
+ *
+ * The chains are singly linked and the link is stored in the node itself, so
+ * a bucket is a single pointer to its first node and the table needs no
+ * separate list objects.
+ *
+ * @var ChainNode::entry
+ * The key-value pair stored in the node.
+ *
+ * @var ChainNode::hash
+ * The hash code of the key.
+ *
+ * @var ChainNode::next
+ * The next node of the chain, or nullptr if this is the last one.
+ */
+struct ChainNode {
+  /**
+   * @brief The key-value pair stored in this node.
+   */
+  std::pair<Key, Value> entry;
+
+  /**
+   * @brief The hash code of the key, kept so that lookups compare keys only
+   * when their codes match and rehashes never hash a key again.
+   */
+  size_t hash;
+
+  /**
+   * @brief The next node of the chain, or nullptr.
+   */
+  ChainNode *next;
+
+  /**
+   * @brief Constructs the last node of a chain.
+   *
+   * @param k The key to store.
+   * @param v The value associated with the key.
+   * @param h The hash code of the key.
+   */
+  ChainNode(const Key &k, const Value &v, size_t h)
+      : entry(k, v), hash(h), next(nullptr) {}
+};
+
+#endif
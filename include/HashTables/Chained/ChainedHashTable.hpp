@@ -2,57 +2,81 @@
 #define CHAINED_HASH_TABLE_HPP
 
 #include <functional>
-#include <list>
 #include <utility>
 #include <vector>
 
 #include "Dictionary/IDictionary.hpp"
 #include "HashTables/Base/BaseHashTable.hpp"
+#include "HashTables/Chained/ChainNode.hpp"
+#include "Utils/Memory/SlabPool.hpp"
 
 /**
  * @brief Hash table implementation using separate chaining.
  *
+ * Each bucket is a pointer to a singly linked chain of nodes, and the nodes
+ * are allocated from a SlabPool owned by the table.
+ *
  * @tparam Key The type of the keys.
  * @tparam Value The type of the values.
  * @tparam Hash The hash function to be used (defaults to std::hash<Key>).
+ * @tparam SizingPolicy Chooses the number of buckets and the bucket of each
+ * hash code (defaults to PrimeSizing; see SizingPolicies.hpp).
  */
-template <typename Key, typename Value, typename Hash = std::hash<Key>>
+template <typename Key, typename Value, typename Hash = std::hash<Key>,
+          typename SizingPolicy = PrimeSizing>
 class ChainedHashTable
     : public IDictionary<Key, Value>,
-      public BaseHashTable<ChainedHashTable<Key, Value, Hash>,
-                           std::list<std::pair<Key, Value>>, Key, Value, Hash> {
+      public BaseHashTable<ChainedHashTable<Key, Value, Hash, SizingPolicy>,
+                           ChainNode<Key, Value> *, Key, Value, Hash,
+                           SizingPolicy> {
+
+  /**
+   * @brief Alias for the node type of the chains.
+   */
+  using Node = ChainNode<Key, Value>;
+
+  /**
+   * @brief Pool the nodes of every chain are allocated from.
+   */
+  SlabPool<Node> pool;
 
   /**
    * @brief Result of a generic find operation within a bucket.
    *
-   * @tparam Iterator Type of the iterator used to traverse the bucket.
-   * @tparam BucketRef Reference type to the bucket container.
+   * @tparam Link Type of a pointer to a link of the chain (a `Node **` or a
+   * `Node *const *`).
    */
-  template <typename Iterator, typename BucketRef> struct GenericFindResult {
+  template <typename Link> struct GenericFindResult {
     /**
-     * @brief Iterator pointing to the found element or end of bucket.
+     * @brief The head of the bucket where the element was searched.
      */
-    Iterator iterator;
+    Link bucket;
 
     /**
-     * @brief Reference to the bucket where the element was searched.
+     * @brief The link pointing to the found node, or the null link at the
+     * end of the bucket if the element was not found.
      */
-    BucketRef bucketRef;
+    Link link;
 
     /**
-     * @brief Constructs a GenericFindResult with the given iterator and bucket
-     * reference.
+     * @brief The hash code of the key searched for.
+     */
+    size_t code;
+
+    /**
+     * @brief Constructs a GenericFindResult with the given bucket head and
+     * link.
      *
-     * @param it Iterator pointing to the element (or end).
-     * @param bRef Reference to the bucket.
+     * @param b The head of the bucket.
+     * @param l The link pointing to the element (or the null link).
+     * @param c The hash code of the key.
      */
-    GenericFindResult(Iterator it, BucketRef bRef);
+    GenericFindResult(Link b, Link l, size_t c);
 
     /**
      * @brief Checks whether the element was found in the bucket.
      *
-     * @return true if the iterator does not point to the end of the bucket;
-     * false otherwise.
+     * @return true if the link points to a node; false otherwise.
      */
     bool wasElementFound() const;
   };
@@ -60,65 +84,77 @@ class ChainedHashTable
   /**
    * @brief Result type used when performing mutable find operations.
    */
-  using FindResult =
-      GenericFindResult<typename std::list<std::pair<Key, Value>>::iterator,
-                        std::list<std::pair<Key, Value>> &>;
+  using FindResult = GenericFindResult<Node **>;
 
   /**
    * @brief Result type used when performing read-only find operations.
    */
-  using ConstFindResult = GenericFindResult<
-      typename std::list<std::pair<Key, Value>>::const_iterator,
-      const std::list<std::pair<Key, Value>> &>;
+  using ConstFindResult = GenericFindResult<Node *const *>;
 
   /**
-   * @brief Computes the hash code for a given key.
+   * @brief Walks a chain looking for a key. The keys of the nodes are
+   * compared only when their hash codes equal `code`.
    *
-   * This function applies the hash function provided by the Hash template
-   * parameter to the given key and ensures the result is within the bounds of
-   * the hash table by taking the modulus with the table size.
+   * @param link The head of the chain.
+   * @param key The key to search for.
+   * @param code The hash code of the key.
+   * @return Link The link pointing to the node of the key, or the null link
+   * at the end of the chain.
    *
-   * @param key The key for which the hash code is to be computed.
-   * @return size_t The computed hash code, which is the index in the hash
-   * table.
+   * @note This method increments the `comparisonsCount` member variable for
+   * each node inspected.
    */
-  size_t hashCode(const Key &key) const;
+  template <typename Link>
+  Link findLink(Link link, const Key &key, size_t code) const;
 
   /**
-   * @brief Finds a constant iterator to a key-value pair in the hash table.
+   * @brief Finds the link to a key-value pair in the hash table, read-only.
    *
-   * This method searches for a key in the hash table and returns a constant
-   * iterator to the key-value pair if found. The search is performed in the
-   * list corresponding to the hash slot of the given key.
+   * The search is performed in the chain corresponding to the hash slot of
+   * the given key, and then, while the table is being rehashed, in its chain
+   * of the old table.
    *
    * @param key The key to search for in the hash table.
    *
-   * @return ConstFindResult A pair consisting of a constant iterator to the
-   * found key-value pair and a reference to the list in which the key-value
-   * pair resides. If the key is not found, the iterator will be equal to the
-   * end iterator of the list.
-   *
-   * @note This method increments the `comparisonsCount` member variable for
-   * each comparison made during the search.
+   * @return ConstFindResult The head of the bucket the key belongs to and the
+   * link pointing to its node. If the key is not found, the link is the null
+   * link at the end of the bucket of the current table.
    */
   ConstFindResult findConstPairIterator(const Key &key) const;
 
   /**
-   * @brief Finds the iterator pointing to the pair with the specified key in
-   * the hash table.
-   *
-   * This method searches for a key-value pair in the hash table and returns a
-   * result containing the iterator to the found pair and a reference to the
-   * bucket (list) where the pair resides.
+   * @brief Finds the link to the pair with the specified key in the hash
+   * table.
    *
    * @param key The key to search for in the hash table.
    * @return FindResult A structure containing:
-   *         - An iterator pointing to the found pair if the key exists, or the
-   * end iterator of the bucket if not.
-   *         - A reference to the bucket (list) where the key would be located.
+   *         - The head of the bucket where the key is, or would be located.
+   *         - The link pointing to the node of the key if it exists, or the
+   * null link at the end of that bucket if not, where a new node can be
+   * appended.
    */
   FindResult findPairIterator(const Key &key);
 
+  /**
+   * @brief Moves the pairs of a bucket of the old table, left by an
+   * incremental rehash, to their buckets in the current table.
+   *
+   * The nodes are relinked rather than copied, so references to the values
+   * stay valid.
+   *
+   * @param index The index of the bucket in the old table.
+   * @return size_t The number of pairs moved.
+   */
+  size_t migrate(size_t index);
+
+  /**
+   * @brief Gives every node of both tables back to the pool.
+   */
+  void destroyNodes();
+
+  friend class BaseHashTable<ChainedHashTable, ChainNode<Key, Value> *, Key,
+                             Value, Hash, SizingPolicy>;
+
 public:
   /**
    * @class ChainedHashTable
@@ -128,12 +164,21 @@ public:
    * to handle collisions. It supports dynamic resizing and rehashing to
    * maintain an efficient load factor.
    *
-   * @param size The initial size of the hash table. Defaults to 7.
+   * @param size The initial size of the hash table, adjusted by
+   * SizingPolicy. Defaults to 7.
    * @param mlf The maximum load factor before rehashing occurs. Defaults
    * to 1.0.
    */
   ChainedHashTable(size_t size = 7, float mlf = 1.0);
 
+  ChainedHashTable(const ChainedHashTable &) = delete;
+  ChainedHashTable &operator=(const ChainedHashTable &) = delete;
+
+  /**
+   * @brief Destroys every node of the table.
+   */
+  ~ChainedHashTable();
+
   /**
    * @brief Inserts a key-value pair into the hash table.
    *
@@ -197,6 +242,13 @@ public:
    */
   void clear() override;
 
+  /**
+   * @brief Shrinks the table to the size SizingPolicy chooses for its keys
+   * under the maximum load factor, and moves every node into a single new
+   * slab, giving back the cells left free by removed keys.
+   */
+  void shrinkToFit() override;
+
   /**
    * @brief Prints the key-value pairs in the hash table to the output stream in
    * ascending order of keys.
@@ -217,6 +269,14 @@ public:
    */
   void printInOrder(std::ostream &out) const override;
 
+  /**
+   * @brief Calls a function on every key-value pair, in no particular order.
+   *
+   * @param action The function called with each key and value.
+   */
+  void forEach(const std::function<void(const Key &, const Value &)> &action)
+      const override;
+
   /**
    * @brief Returns the current value of the comparisons count.
    *
@@ -243,11 +303,7 @@ public:
    * @param key The key whose associated value is to be accessed or inserted.
    * @return A reference to the value associated with the key.
    * @note This operator modifies the hash table if the key does not exist.
-   * It assumes the existence of `findPairIterator` member function that
-   * returns a `FindResult` struct/object with `wasElementFound()` and
-   * `bucketRef` (a reference to the bucket list/vector) and `iterator`
-   * (an iterator to the found element). It also assumes `Value` is
-   * default-constructible.
+   * It assumes `Value` is default-constructible.
    */
   Value &operator[](const Key &key) override;
 
@@ -264,23 +320,47 @@ public:
    * @param key The key whose associated value is to be accessed.
    * @return A const reference to the value associated with the key.
    * @throws KeyNotFoundException If the key does not exist in the hash table.
-   * @note This operator assumes the existence of a `findPairIterator` member
-   * function (or a `const` overloaded version of it) that returns a
-   * `FindResult` struct/object with `wasElementFound()` and `iterator` (an
-   * iterator to the found element).
    */
   const Value &operator[](const Key &key) const override;
 
+  /**
+   * @brief Adds every key-value pair of another dictionary to this table.
+   *
+   * Any rehash of this table in progress is completed first. When `other`
+   * is this table, every value is doubled in place. When it is another
+   * ChainedHashTable of the same type with as many buckets, not being
+   * rehashed, each of its keys belongs to the bucket of the same index here,
+   * so the buckets are merged pairwise without hashing any key, and the
+   * table is resized at most once at the end. Otherwise the table is first
+   * grown to hold both sets of keys, and every pair is incremented in turn.
+   *
+   * @param other The dictionary to merge from.
+   */
+  void mergeFrom(const IDictionary<Key, Value> &other) override;
+
+  /**
+   * @brief Grows the table so that `n` keys fit under the maximum load
+   * factor, and sets aside nodes for the keys still missing.
+   *
+   * The nodes come from a single slab of the pool, so inserting the `n` keys
+   * afterwards allocates nothing.
+   *
+   * @param n The number of keys to make room for.
+   */
+  void reserve(size_t n) override;
+
   /**
    * @brief Rehashes the hash table to a new size.
    *
-   * This function resizes the hash table to a new size that is the next prime
-   * number greater than or equal to the specified size `m`. It redistributes
-   * all existing key-value pairs into the new table, ensuring that the hash
-   * table maintains its integrity and performance.
+   * This function resizes the hash table to the size SizingPolicy chooses
+   * for at least `m` buckets, if it is larger than the current one. The
+   * existing key-value pairs are redistributed incrementally: the old table
+   * is kept alongside the new one, lookups search both, and each following
+   * insertion moves a few of its buckets over, so that no single operation
+   * pays for the whole resize.
    *
-   * @param m The minimum size for the new hash table. The actual size will be
-   *          the next prime number greater than or equal to `m`.
+   * @param m The minimum size for the new hash table. The actual size is
+   *          given by `SizingPolicy::fit(m)`.
    */
   void rehash(size_t m);
 
@@ -291,7 +371,9 @@ public:
    * A collision occurs when two different keys are hashed to the same index in
    * the hash table. This method provides a count of such occurrences, which can
    * be useful for analyzing the efficiency of the hash function and the load
-   * factor of the table.
+   * factor of the table. One is counted whenever a new key, added through
+   * insert(), operator[] or mergeFrom(), goes into a non-empty bucket; the
+   * moves of a rehash are not counted.
    *
    * @return size_t The number of collisions that have occurred in the hash
    * table.
@@ -309,6 +391,15 @@ public:
    */
   size_t getTableSize() const;
 
+  /**
+   * @brief Returns how many buckets hold each number of keys: the k-th
+   * element counts the buckets whose chain has k nodes.
+   *
+   * The buckets of the old table not migrated yet during an incremental
+   * rehash are included. Takes a walk over every chain.
+   */
+  std::vector<size_t> getChainLengthHistogram() const;
+
   /**
    * @brief Prints the contents of the hash table to the standard output.
    *
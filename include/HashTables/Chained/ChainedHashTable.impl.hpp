@@ -6,155 +6,230 @@
 #include "Exceptions/KeyExceptions.hpp"
 #include "Utils/Strings/StringHandler.hpp"
 
-template <typename Key, typename Value, typename Hash>
-template <typename Iterator, typename BucketRef>
-ChainedHashTable<Key, Value, Hash>::GenericFindResult<
-    Iterator, BucketRef>::GenericFindResult(Iterator it, BucketRef bRef)
-    : iterator(it), bucketRef(bRef) {}
-
-template <typename Key, typename Value, typename Hash>
-template <typename Iterator, typename BucketRef>
-bool ChainedHashTable<Key, Value, Hash>::GenericFindResult<
-    Iterator, BucketRef>::wasElementFound() const {
-  return iterator != bucketRef.end();
-}
-
-template <typename Key, typename Value, typename Hash>
-ChainedHashTable<Key, Value, Hash>::ChainedHashTable(size_t size, float mlf)
-    : BaseHashTable<ChainedHashTable<Key, Value, Hash>,
-                    std::list<std::pair<Key, Value>>, Key, Value, Hash>(
-          this->getNextPrime(size), mlf) {}
-
-template <typename Key, typename Value, typename Hash>
-size_t ChainedHashTable<Key, Value, Hash>::hashCode(const Key &key) const {
-  return this->hashing(key) % this->tableSize;
-}
-
-template <typename Key, typename Value, typename Hash>
-void ChainedHashTable<Key, Value, Hash>::rehash(size_t m) {
-  size_t newTableSize = this->getNextPrime(m);
-
-  if (newTableSize > this->tableSize) {
-    std::vector<std::list<std::pair<Key, Value>>> copy = this->table;
-    this->table.clear();
-    this->table.resize(newTableSize);
-    this->tableSize = newTableSize;
-    this->numberOfElements = 0;
-
-    for (auto &line : copy) {
-      for (auto &[k, v] : line)
-        insert(k, v);
-      line.clear();
+template <typename Key, typename Value, typename Hash, typename SizingPolicy>
+template <typename Link>
+ChainedHashTable<Key, Value, Hash, SizingPolicy>::GenericFindResult<
+    Link>::GenericFindResult(Link b, Link l, size_t c)
+    : bucket(b), link(l), code(c) {}
+
+template <typename Key, typename Value, typename Hash, typename SizingPolicy>
+template <typename Link>
+bool ChainedHashTable<Key, Value, Hash, SizingPolicy>::GenericFindResult<
+    Link>::wasElementFound() const {
+  return *link != nullptr;
+}
+
+template <typename Key, typename Value, typename Hash, typename SizingPolicy>
+ChainedHashTable<Key, Value, Hash, SizingPolicy>::ChainedHashTable(size_t size,
+                                                                   float mlf)
+    : BaseHashTable<ChainedHashTable, ChainNode<Key, Value> *, Key, Value, Hash,
+                    SizingPolicy>(SizingPolicy::fit(size), mlf) {}
+
+template <typename Key, typename Value, typename Hash, typename SizingPolicy>
+ChainedHashTable<Key, Value, Hash, SizingPolicy>::~ChainedHashTable() {
+  destroyNodes();
+}
+
+template <typename Key, typename Value, typename Hash, typename SizingPolicy>
+void ChainedHashTable<Key, Value, Hash, SizingPolicy>::rehash(size_t m) {
+  size_t newTableSize = SizingPolicy::fit(m);
+
+  if (newTableSize > this->tableSize)
+    this->beginRehash(newTableSize);
+}
+
+template <typename Key, typename Value, typename Hash, typename SizingPolicy>
+size_t ChainedHashTable<Key, Value, Hash, SizingPolicy>::migrate(size_t index) {
+  Node *&line = this->oldTable[index];
+  size_t moved = 0;
+
+  for (; line; moved++) {
+    Node *node = line;
+    line = node->next;
+    node->next = nullptr;
+
+    Node **link = &this->table[this->sizing.bucket(node->hash)];
+    while (*link)
+      link = &(*link)->next;
+
+    *link = node;
+  }
+
+  return moved;
+}
+
+template <typename Key, typename Value, typename Hash, typename SizingPolicy>
+void ChainedHashTable<Key, Value, Hash, SizingPolicy>::destroyNodes() {
+  for (auto *lines : {&this->table, &this->oldTable}) {
+    for (Node *&line : *lines) {
+      while (line) {
+        Node *node = line;
+        line = node->next;
+        pool.destroy(node);
+      }
     }
   }
 }
 
-template <typename Key, typename Value, typename Hash>
-typename ChainedHashTable<Key, Value, Hash>::FindResult
-ChainedHashTable<Key, Value, Hash>::findPairIterator(const Key &key) {
-  size_t slot = hashCode(key);
+template <typename Key, typename Value, typename Hash, typename SizingPolicy>
+template <typename Link>
+Link ChainedHashTable<Key, Value, Hash, SizingPolicy>::findLink(
+    Link link, const Key &key, size_t code) const {
+  while (*link) {
+    this->comparisonsCount++;
+    if ((*link)->hash == code and (*link)->entry.first == key)
+      break;
+
+    link = &(*link)->next;
+  }
+
+  return link;
+}
+
+template <typename Key, typename Value, typename Hash, typename SizingPolicy>
+typename ChainedHashTable<Key, Value, Hash, SizingPolicy>::FindResult
+ChainedHashTable<Key, Value, Hash, SizingPolicy>::findPairIterator(
+    const Key &key) {
+  size_t code = this->hashing(key);
 
-  std::list<std::pair<Key, Value>> &lst = this->table[slot];
+  Node **bucket = &this->table[this->sizing.bucket(code)];
+  Node **link = findLink(bucket, key, code);
 
-  auto it = std::find_if(lst.begin(), lst.end(),
-                         [this, &key](const std::pair<Key, Value> &p) {
-                           this->comparisonsCount++;
-                           return p.first == key;
-                         });
+  // Keys not migrated yet are still in the old table.
+  if (!*link and this->isRehashing()) {
+    Node **old = &this->oldTable[this->oldSizing.bucket(code)];
+    Node **oldLink = findLink(old, key, code);
+
+    if (*oldLink)
+      return FindResult(old, oldLink, code);
+  }
 
-  return FindResult(it, lst);
+  return FindResult(bucket, link, code);
 }
 
-template <typename Key, typename Value, typename Hash>
-typename ChainedHashTable<Key, Value, Hash>::ConstFindResult
-ChainedHashTable<Key, Value, Hash>::findConstPairIterator(
+template <typename Key, typename Value, typename Hash, typename SizingPolicy>
+typename ChainedHashTable<Key, Value, Hash, SizingPolicy>::ConstFindResult
+ChainedHashTable<Key, Value, Hash, SizingPolicy>::findConstPairIterator(
     const Key &key) const {
-  size_t slot = hashCode(key);
+  size_t code = this->hashing(key);
 
-  const std::list<std::pair<Key, Value>> &lst = this->table[slot];
+  Node *const *bucket = &this->table[this->sizing.bucket(code)];
+  Node *const *link = findLink(bucket, key, code);
 
-  auto it = std::find_if(lst.begin(), lst.end(),
-                         [this, &key](const std::pair<Key, Value> &p) {
-                           this->comparisonsCount++;
-                           return p.first == key;
-                         });
+  if (!*link and this->isRehashing()) {
+    Node *const *old = &this->oldTable[this->oldSizing.bucket(code)];
+    Node *const *oldLink = findLink(old, key, code);
 
-  return ConstFindResult(it, lst);
+    if (*oldLink)
+      return ConstFindResult(old, oldLink, code);
+  }
+
+  return ConstFindResult(bucket, link, code);
 }
 
-template <typename Key, typename Value, typename Hash>
-void ChainedHashTable<Key, Value, Hash>::insert(const Key &key,
+template <typename Key, typename Value, typename Hash, typename SizingPolicy>
+void ChainedHashTable<Key, Value, Hash, SizingPolicy>::insert(const Key &key,
                                                 const Value &value) {
   this->checkAndRehash();
 
-  size_t slot = hashCode(key);
+  FindResult response = findPairIterator(key);
 
-  if (!this->table[slot].empty())
-    this->incrementCollisionsCount();
+  if (response.wasElementFound())
+    throw KeyAlreadyExistsException();
 
-  for (const auto &p : this->table[slot]) {
-    this->comparisonsCount++;
-    if (p.first == key)
-      throw KeyAlreadyExistsException();
-  }
+  if (*response.bucket)
+    this->incrementCollisionsCount();
 
-  this->table[slot].push_back({key, value});
+  *response.link = pool.create(key, value, response.code);
   this->numberOfElements++;
 }
 
-template <typename Key, typename Value, typename Hash>
-bool ChainedHashTable<Key, Value, Hash>::find(const Key &key,
+template <typename Key, typename Value, typename Hash, typename SizingPolicy>
+bool ChainedHashTable<Key, Value, Hash, SizingPolicy>::find(const Key &key,
                                               Value &outValue) const {
   ConstFindResult response = findConstPairIterator(key);
 
   bool wasFound = response.wasElementFound();
 
   if (wasFound)
-    outValue = response.iterator->second;
+    outValue = (*response.link)->entry.second;
 
   return wasFound;
 }
 
-template <typename Key, typename Value, typename Hash>
-void ChainedHashTable<Key, Value, Hash>::update(const Key &key,
+template <typename Key, typename Value, typename Hash, typename SizingPolicy>
+void ChainedHashTable<Key, Value, Hash, SizingPolicy>::update(const Key &key,
                                                 const Value &value) {
   FindResult response = findPairIterator(key);
 
   if (!response.wasElementFound())
     throw KeyNotFoundException();
 
-  response.iterator->second = value;
+  (*response.link)->entry.second = value;
 }
 
-template <typename Key, typename Value, typename Hash>
-void ChainedHashTable<Key, Value, Hash>::remove(const Key &key) {
+template <typename Key, typename Value, typename Hash, typename SizingPolicy>
+void ChainedHashTable<Key, Value, Hash, SizingPolicy>::remove(const Key &key) {
   FindResult response = findPairIterator(key);
 
   if (response.wasElementFound()) {
-    response.bucketRef.erase(response.iterator);
+    Node *node = *response.link;
+    *response.link = node->next;
+    pool.destroy(node);
     this->numberOfElements--;
   }
 }
 
-template <typename Key, typename Value, typename Hash>
-void ChainedHashTable<Key, Value, Hash>::clear() {
+template <typename Key, typename Value, typename Hash, typename SizingPolicy>
+void ChainedHashTable<Key, Value, Hash, SizingPolicy>::clear() {
+  destroyNodes();
+  pool.clear();
   this->clearHashTable();
 }
 
-template <typename Key, typename Value, typename Hash>
-void ChainedHashTable<Key, Value, Hash>::printInOrder(std::ostream &out) const {
+template <typename Key, typename Value, typename Hash, typename SizingPolicy>
+void ChainedHashTable<Key, Value, Hash, SizingPolicy>::shrinkToFit() {
+  this->completeRehash();
+
+  size_t size = SizingPolicy::fit(
+      static_cast<size_t>(this->numberOfElements / this->maxLoadFactor) + 1);
+
+  if (size < this->tableSize) {
+    this->beginRehash(size);
+    this->completeRehash();
+  }
+
+  SlabPool<Node> packed;
+  packed.reserve(this->numberOfElements);
+
+  for (Node *&bucket : this->table) {
+    for (Node **link = &bucket; *link; link = &(*link)->next) {
+      Node *node = *link;
+      Node *copy =
+          packed.create(node->entry.first, node->entry.second, node->hash);
+
+      copy->next = node->next;
+      *link = copy;
+      pool.destroy(node);
+    }
+  }
+
+  pool.swap(packed);
+}
+
+template <typename Key, typename Value, typename Hash, typename SizingPolicy>
+void ChainedHashTable<Key, Value, Hash, SizingPolicy>::printInOrder(
+    std::ostream &out) const {
   size_t maxKeyLen = 0, maxValLen = 0;
   std::vector<std::pair<Key, Value>> vec(this->numberOfElements);
 
   size_t i = 0;
-  for (const auto &line : this->table) {
-    for (const auto &p : line) {
-      maxKeyLen = std::max(maxKeyLen, StringHandler::size(p.first));
-      maxValLen = std::max(maxValLen, StringHandler::size(p.second));
+  forEach([&](const Key &key, const Value &value) {
+    maxKeyLen = std::max(maxKeyLen, StringHandler::size(key));
+    maxValLen = std::max(maxValLen, StringHandler::size(value));
 
-      vec[i++] = p;
-    }
-  }
+    vec[i++] = {key, value};
+  });
 
   std::sort(vec.begin(), vec.end(),
             [](const auto &pa, const auto &pb) { return pa.first < pb.first; });
@@ -165,71 +240,194 @@ void ChainedHashTable<Key, Value, Hash>::printInOrder(std::ostream &out) const {
   }
 }
 
-template <typename Key, typename Value, typename Hash>
-size_t ChainedHashTable<Key, Value, Hash>::getComparisonsCount() const {
+template <typename Key, typename Value, typename Hash, typename SizingPolicy>
+void ChainedHashTable<Key, Value, Hash, SizingPolicy>::forEach(
+    const std::function<void(const Key &, const Value &)> &action) const {
+  for (const auto *lines : {&this->table, &this->oldTable})
+    for (const Node *line : *lines)
+      for (const Node *node = line; node; node = node->next)
+        action(node->entry.first, node->entry.second);
+}
+
+template <typename Key, typename Value, typename Hash, typename SizingPolicy>
+size_t ChainedHashTable<Key, Value, Hash, SizingPolicy>::getComparisonsCount()
+    const {
   return this->comparisonsCount;
 }
 
-template <typename Key, typename Value, typename Hash>
-Value &ChainedHashTable<Key, Value, Hash>::operator[](const Key &key) {
+template <typename Key, typename Value, typename Hash, typename SizingPolicy>
+Value &ChainedHashTable<Key, Value, Hash, SizingPolicy>::operator[](
+    const Key &key) {
   this->checkAndRehash();
 
   FindResult response = findPairIterator(key);
 
   if (!response.wasElementFound()) {
+    if (*response.bucket)
+      this->incrementCollisionsCount();
 
-    response.bucketRef.push_back({key, Value()});
+    *response.link = pool.create(key, Value(), response.code);
     this->numberOfElements++;
-    return response.bucketRef.back().second;
-  } else {
-    return response.iterator->second;
   }
+
+  return (*response.link)->entry.second;
 }
 
-template <typename Key, typename Value, typename Hash>
+template <typename Key, typename Value, typename Hash, typename SizingPolicy>
 const Value &
-ChainedHashTable<Key, Value, Hash>::operator[](const Key &key) const {
+ChainedHashTable<Key, Value, Hash, SizingPolicy>::operator[](
+    const Key &key) const {
   ConstFindResult response = findConstPairIterator(key);
 
   if (!response.wasElementFound()) {
     throw KeyNotFoundException();
   } else {
-    return response.iterator->second;
+    return (*response.link)->entry.second;
+  }
+}
+
+template <typename Key, typename Value, typename Hash, typename SizingPolicy>
+void ChainedHashTable<Key, Value, Hash, SizingPolicy>::mergeFrom(
+    const IDictionary<Key, Value> &other) {
+  const ChainedHashTable *chained =
+      dynamic_cast<const ChainedHashTable *>(&other);
+
+  // Finishing any rehash first leaves a single storage to walk and merge.
+  this->completeRehash();
+
+  if (chained == this) {
+    for (Node *line : this->table)
+      for (Node *node = line; node; node = node->next)
+        node->entry.second += node->entry.second;
+    return;
+  }
+
+  if (!chained or chained->tableSize != this->tableSize or
+      chained->isRehashing()) {
+    size_t incoming = 0;
+    other.forEach([&incoming](const Key &, const Value &) { incoming++; });
+
+    // Only the table is grown up front: `incoming` also counts the keys both
+    // dictionaries share, which need no new node.
+    size_t expected = this->numberOfElements + incoming;
+    if (expected >= this->maxLoadFactor * this->tableSize) {
+      rehash(static_cast<size_t>(expected / this->maxLoadFactor) + 1);
+      this->completeRehash();
+    }
+
+    return IDictionary<Key, Value>::mergeFrom(other);
+  }
+
+  for (size_t i = 0; i < this->tableSize; i++) {
+    Node *&bucket = this->table[i];
+    Node **tail = &bucket;
+    size_t ownSize = 0;
+
+    for (; *tail; tail = &(*tail)->next)
+      ownSize++;
+
+    for (const Node *other = chained->table[i]; other; other = other->next) {
+      const auto &[key, value] = other->entry;
+      Node *node = bucket;
+      bool found = false;
+
+      // Keys appended from the other bucket are distinct from each other, so
+      // only the pairs that were already here need to be compared.
+      for (size_t j = 0; j < ownSize and !found; j++, node = node->next) {
+        this->comparisonsCount++;
+        if (node->hash == other->hash and node->entry.first == key) {
+          node->entry.second += value;
+          found = true;
+        }
+      }
+
+      if (!found) {
+        if (bucket)
+          this->incrementCollisionsCount();
+
+        *tail = pool.create(key, value, other->hash);
+        tail = &(*tail)->next;
+        this->numberOfElements++;
+      }
+    }
   }
+
+  if (this->getLoadFactor() >= this->maxLoadFactor)
+    rehash(static_cast<size_t>(this->numberOfElements / this->maxLoadFactor) +
+           1);
 }
 
-template <typename Key, typename Value, typename Hash>
-size_t ChainedHashTable<Key, Value, Hash>::getCollisionsCount() const {
+template <typename Key, typename Value, typename Hash, typename SizingPolicy>
+void ChainedHashTable<Key, Value, Hash, SizingPolicy>::reserve(size_t n) {
+  if (n >= this->maxLoadFactor * this->tableSize)
+    rehash(static_cast<size_t>(n / this->maxLoadFactor) + 1);
+
+  if (n > this->numberOfElements)
+    pool.reserve(n - this->numberOfElements);
+}
+
+template <typename Key, typename Value, typename Hash, typename SizingPolicy>
+size_t ChainedHashTable<Key, Value, Hash, SizingPolicy>::getCollisionsCount()
+    const {
   return this->collisionsCount;
 }
 
-template <typename Key, typename Value, typename Hash>
-size_t ChainedHashTable<Key, Value, Hash>::getTableSize() const {
+template <typename Key, typename Value, typename Hash, typename SizingPolicy>
+size_t ChainedHashTable<Key, Value, Hash, SizingPolicy>::getTableSize() const {
   return this->tableSize;
 }
 
-template <typename Key, typename Value, typename Hash>
-void ChainedHashTable<Key, Value, Hash>::print() const {
+template <typename Key, typename Value, typename Hash, typename SizingPolicy>
+std::vector<size_t>
+ChainedHashTable<Key, Value, Hash, SizingPolicy>::getChainLengthHistogram()
+    const {
+  std::vector<size_t> histogram(1, 0);
+
+  auto addBucket = [&](const Node *node) {
+    size_t length = 0;
+    for (; node; node = node->next)
+      length++;
+
+    if (length >= histogram.size())
+      histogram.resize(length + 1, 0);
+    histogram[length]++;
+  };
+
+  for (const Node *node : this->table)
+    addBucket(node);
+
+  for (size_t i = this->rehashIndex; i < this->oldTable.size(); i++)
+    addBucket(this->oldTable[i]);
+
+  return histogram;
+}
+
+template <typename Key, typename Value, typename Hash, typename SizingPolicy>
+void ChainedHashTable<Key, Value, Hash, SizingPolicy>::print() const {
   for (size_t i = 0; i < this->table.size(); ++i) {
     std::cout << "Slot " << i << ": ";
-    if (this->table[i].empty()) {
+    if (!this->table[i]) {
       std::cout << "Empty";
     } else {
-      for (const auto &pair : this->table[i]) {
-        std::cout << "[" << pair.first << ": " << pair.second << "] ";
+      for (const Node *node = this->table[i]; node; node = node->next) {
+        std::cout << "[" << node->entry.first << ": " << node->entry.second
+                  << "] ";
       }
     }
     std::cout << "\n";
   }
 }
 
-template <typename Key, typename Value, typename Hash>
-void ChainedHashTable<Key, Value, Hash>::accept(
+template <typename Key, typename Value, typename Hash, typename SizingPolicy>
+void ChainedHashTable<Key, Value, Hash, SizingPolicy>::accept(
     IDictionaryVisitor<Key, Value> &visitor) const {
   visitor.collectMetrics(*this);
 }
 
-template <typename Key, typename Value, typename Hash>
-size_t ChainedHashTable<Key, Value, Hash>::getMemoryUsage() const {
-  return this->sizeOf();
+template <typename Key, typename Value, typename Hash, typename SizingPolicy>
+size_t ChainedHashTable<Key, Value, Hash, SizingPolicy>::getMemoryUsage()
+    const {
+  return sizeof(*this) +
+         (this->table.capacity() + this->oldTable.capacity()) * sizeof(Node *) +
+         pool.getMemoryUsage();
 }
\ No newline at end of file
@@ -0,0 +1,321 @@
+#ifndef EXTENDIBLE_HASH_TABLE_HPP
+#define EXTENDIBLE_HASH_TABLE_HPP
+
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "Dictionary/IDictionary.hpp"
+
+/**
+ * @brief A hash table using extendible hashing, which grows one bucket at a
+ * time instead of rehashing every key at once.
+ *
+ * Keys live in buckets of a fixed capacity. A directory of 2^globalDepth
+ * pointers maps the low globalDepth bits of a key's hash code to its bucket;
+ * a bucket of local depth d is shared by the 2^(globalDepth - d) directory
+ * entries that agree on the low d bits. When a key arrives at a full bucket,
+ * only that bucket is split: its keys are divided between it and a new
+ * bucket by bit d of their codes, and the directory entries of the new
+ * bucket are redirected to it. The directory itself is doubled, by copying
+ * its pointers, only when the full bucket's local depth already equals the
+ * global depth.
+ *
+ * Buckets are never merged back when keys are removed.
+ *
+ * @tparam Key The type of the keys.
+ * @tparam Value The type of the values.
+ * @tparam Hash The hash function to be used (defaults to std::hash<Key>).
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class ExtendibleHashTable : public IDictionary<Key, Value> {
+public:
+  /**
+   * @brief Default number of keys each bucket holds.
+   */
+  static const size_t DEFAULT_BUCKET_CAPACITY = 16;
+
+  /**
+   * @brief Maximum depth of the directory. Buckets whose keys still share
+   * this many low bits of their codes are allowed to overflow instead of
+   * being split again.
+   */
+  static const size_t MAX_DEPTH = 24;
+
+private:
+  /**
+   * @brief A key-value pair together with the hash code of its key, so that
+   * splits never hash a key again.
+   */
+  struct Entry {
+    uint64_t code;
+    Key key;
+    Value value;
+  };
+
+  /**
+   * @brief A bucket and the number of low code bits its keys share.
+   */
+  struct Bucket {
+    size_t localDepth;
+    std::vector<Entry> entries;
+  };
+
+  /**
+   * @brief Maps the low bits of a hash code to the bucket of the key.
+   */
+  std::vector<Bucket *> directory;
+
+  /**
+   * @brief Every bucket, each one exactly once.
+   */
+  std::vector<std::unique_ptr<Bucket>> buckets;
+
+  /**
+   * @brief The number of low code bits used to index the directory.
+   */
+  size_t globalDepth;
+
+  /**
+   * @brief The global depth the table starts with, restored by clear().
+   */
+  size_t initialDepth;
+
+  /**
+   * @brief The number of keys each bucket holds before it is split.
+   */
+  size_t bucketCapacity;
+
+  /**
+   * @brief The number of keys stored.
+   */
+  size_t numberOfElements;
+
+  /**
+   * @brief The number of bucket splits performed.
+   */
+  size_t splitsCount;
+
+  /**
+   * @brief The number of times the directory was doubled.
+   */
+  size_t doublingsCount;
+
+  /**
+   * @brief Hash function object used to compute the hash codes of the keys.
+   */
+  Hash hashing;
+
+  /**
+   * @brief Returns the hash code of a key, mixed so that its low bits can
+   * index the directory.
+   */
+  uint64_t codeOf(const Key &key) const;
+
+  /**
+   * @brief Returns the bucket a hash code maps to.
+   */
+  Bucket *bucketOf(uint64_t code) const;
+
+  /**
+   * @brief Allocates an empty bucket with room for `bucketCapacity` keys.
+   *
+   * @param localDepth The local depth of the new bucket.
+   * @return Bucket* The new bucket, owned by the table.
+   */
+  Bucket *newBucket(size_t localDepth);
+
+  /**
+   * @brief Creates a directory of 2^depth entries, each with a bucket of its
+   * own.
+   */
+  void initialize(size_t depth);
+
+  /**
+   * @brief Finds the entry of a key.
+   *
+   * @param key The key to look for.
+   * @param code The hash code of the key.
+   * @return Entry* The entry of the key, or nullptr if it is absent.
+   */
+  Entry *findEntry(const Key &key, uint64_t code) const;
+
+  /**
+   * @brief Inserts a key known to be absent, splitting its bucket as many
+   * times as needed to make room for it.
+   *
+   * @return Entry* The entry of the new key.
+   */
+  Entry *insertEntry(const Key &key, const Value &value, uint64_t code);
+
+  /**
+   * @brief Splits a full bucket in two by the next bit of its keys' codes,
+   * doubling the directory first if the bucket's local depth equals the
+   * global depth.
+   *
+   * @param bucket The bucket to split. Must not be empty.
+   */
+  void split(Bucket *bucket);
+
+public:
+  /**
+   * @brief Constructs an empty table.
+   *
+   * @param initialBuckets The number of buckets to start with, rounded up to
+   * a power of two.
+   * @param capacity The number of keys each bucket holds.
+   */
+  explicit ExtendibleHashTable(size_t initialBuckets = 1,
+                               size_t capacity = DEFAULT_BUCKET_CAPACITY);
+
+  /**
+   * @brief Inserts a key-value pair.
+   *
+   * @param key The key to be inserted.
+   * @param value The value associated with the key.
+   * @throws KeyAlreadyExistsException If the key is already present.
+   */
+  void insert(const Key &key, const Value &value) override;
+
+  /**
+   * @brief Searches for a key and retrieves its value if found.
+   *
+   * @param key The key to search for.
+   * @param outValue Receives the value of the key, if found.
+   * @return true if the key is found; false otherwise.
+   */
+  bool find(const Key &key, Value &outValue) const override;
+
+  /**
+   * @brief Replaces the value of an existing key.
+   *
+   * @param key The key to be updated.
+   * @param value The new value.
+   * @throws KeyNotFoundException If the key is not present.
+   */
+  void update(const Key &key, const Value &value) override;
+
+  /**
+   * @brief Removes a key, if present. Its bucket is not merged back with its
+   * sibling, even if it becomes empty.
+   *
+   * @param key The key to be removed.
+   */
+  void remove(const Key &key) override;
+
+  /**
+   * @brief Removes every key, restoring the initial directory, and resets the
+   * statistics.
+   */
+  void clear() override;
+
+  /**
+   * @brief Starts an empty table with enough buckets for `n` keys to fill
+   * about two thirds of each, so that inserting them splits few buckets.
+   *
+   * A table that already holds keys grows by splits as usual, and reserving
+   * does nothing. clear() still restores the initial directory.
+   *
+   * @param n The number of keys to make room for.
+   */
+  void reserve(size_t n) override;
+
+  /**
+   * @brief Rebuilds the table from its initial directory, reserved for the
+   * keys it holds, so that the buckets emptied by removals are dropped.
+   * The hash codes stored with the keys are reused.
+   */
+  void shrinkToFit() override;
+
+  /**
+   * @brief Prints the key-value pairs ordered by key.
+   *
+   * @param out The output stream.
+   */
+  void printInOrder(std::ostream &out) const override;
+
+  /**
+   * @brief Calls a function on every key-value pair, in no particular order.
+   *
+   * @param action The function called with each key and value.
+   */
+  void forEach(const std::function<void(const Key &, const Value &)> &action)
+      const override;
+
+  /**
+   * @brief Returns the number of entries inspected by lookups.
+   */
+  size_t getComparisonsCount() const override;
+
+  /**
+   * @brief Returns a reference to the value of a key, inserting a
+   * default-constructed value if the key is not present.
+   *
+   * The reference is invalidated when the bucket of the key is split.
+   *
+   * @param key The key to access.
+   * @return Value& A reference to the value.
+   */
+  Value &operator[](const Key &key) override;
+
+  /**
+   * @brief Returns a const reference to the value of a key.
+   *
+   * @param key The key to access.
+   * @return const Value& A reference to the value.
+   * @throws KeyNotFoundException If the key is not present.
+   */
+  const Value &operator[](const Key &key) const override;
+
+  /**
+   * @brief Returns the number of keys stored.
+   */
+  size_t size() const;
+
+  /**
+   * @brief Returns the number of bucket splits performed.
+   */
+  size_t getSplitsCount() const;
+
+  /**
+   * @brief Returns the number of times the directory was doubled.
+   */
+  size_t getDoublingsCount() const;
+
+  /**
+   * @brief Returns the number of entries of the directory.
+   */
+  size_t getDirectorySize() const;
+
+  /**
+   * @brief Returns the number of low code bits used to index the directory.
+   */
+  size_t getGlobalDepth() const;
+
+  /**
+   * @brief Returns the number of buckets.
+   */
+  size_t getBucketsCount() const;
+
+  /**
+   * @brief Returns the number of keys each bucket holds.
+   */
+  size_t getBucketCapacity() const;
+
+  /**
+   * @brief Accepts a visitor implementing IDictionaryVisitor interface to
+   * collect metrics or perform operations on the ExtendibleHashTable.
+   *
+   * @param visitor A reference to an IDictionaryVisitor<Key, Value> object that
+   * will interact with the ExtendibleHashTable.
+   */
+  void accept(IDictionaryVisitor<Key, Value> &visitor) const override;
+
+  size_t getMemoryUsage() const override;
+};
+
+#include "HashTables/Extendible/ExtendibleHashTable.impl.hpp"
+
+#endif
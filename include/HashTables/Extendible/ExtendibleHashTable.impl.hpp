@@ -0,0 +1,324 @@
+#include "HashTables/Extendible/ExtendibleHashTable.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+#include "Exceptions/KeyExceptions.hpp"
+#include "Utils/Strings/StringHandler.hpp"
+
+template <typename Key, typename Value, typename Hash>
+uint64_t ExtendibleHashTable<Key, Value, Hash>::codeOf(const Key &key) const {
+  uint64_t h = hashing(key);
+  h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+  return h ^ (h >> 31);
+}
+
+template <typename Key, typename Value, typename Hash>
+typename ExtendibleHashTable<Key, Value, Hash>::Bucket *
+ExtendibleHashTable<Key, Value, Hash>::bucketOf(uint64_t code) const {
+  return directory[code & (directory.size() - 1)];
+}
+
+template <typename Key, typename Value, typename Hash>
+typename ExtendibleHashTable<Key, Value, Hash>::Bucket *
+ExtendibleHashTable<Key, Value, Hash>::newBucket(size_t localDepth) {
+  buckets.push_back(std::make_unique<Bucket>());
+
+  Bucket *bucket = buckets.back().get();
+  bucket->localDepth = localDepth;
+  bucket->entries.reserve(bucketCapacity);
+
+  return bucket;
+}
+
+template <typename Key, typename Value, typename Hash>
+void ExtendibleHashTable<Key, Value, Hash>::initialize(size_t depth) {
+  globalDepth = depth;
+  directory.clear();
+  buckets.clear();
+
+  for (size_t i = 0; i < (size_t(1) << depth); i++)
+    directory.push_back(newBucket(depth));
+}
+
+template <typename Key, typename Value, typename Hash>
+typename ExtendibleHashTable<Key, Value, Hash>::Entry *
+ExtendibleHashTable<Key, Value, Hash>::findEntry(const Key &key,
+                                                 uint64_t code) const {
+  for (Entry &entry : bucketOf(code)->entries) {
+    this->incrementCounter(1);
+
+    if (entry.code == code and entry.key == key)
+      return &entry;
+  }
+
+  return nullptr;
+}
+
+template <typename Key, typename Value, typename Hash>
+typename ExtendibleHashTable<Key, Value, Hash>::Entry *
+ExtendibleHashTable<Key, Value, Hash>::insertEntry(const Key &key,
+                                                   const Value &value,
+                                                   uint64_t code) {
+  Bucket *bucket = bucketOf(code);
+
+  while (bucket->entries.size() >= bucketCapacity and
+         bucket->localDepth < MAX_DEPTH) {
+    split(bucket);
+    bucket = bucketOf(code);
+  }
+
+  bucket->entries.push_back({code, key, value});
+  numberOfElements++;
+
+  return &bucket->entries.back();
+}
+
+template <typename Key, typename Value, typename Hash>
+void ExtendibleHashTable<Key, Value, Hash>::split(Bucket *bucket) {
+  if (bucket->localDepth == globalDepth) {
+    size_t size = directory.size();
+
+    directory.reserve(2 * size);
+    for (size_t i = 0; i < size; i++)
+      directory.push_back(directory[i]);
+
+    globalDepth++;
+    doublingsCount++;
+  }
+
+  size_t bit = size_t(1) << bucket->localDepth;
+  size_t pattern = bucket->entries.front().code & (bit - 1);
+
+  bucket->localDepth++;
+  Bucket *sibling = newBucket(bucket->localDepth);
+
+  // The keys whose new bit is set move to the sibling.
+  auto moved = std::stable_partition(
+      bucket->entries.begin(), bucket->entries.end(),
+      [bit](const Entry &entry) { return !(entry.code & bit); });
+
+  std::move(moved, bucket->entries.end(),
+            std::back_inserter(sibling->entries));
+  bucket->entries.erase(moved, bucket->entries.end());
+
+  // Of the directory entries sharing the bucket, those with the new bit set
+  // now point to the sibling.
+  for (size_t i = pattern | bit; i < directory.size(); i += 2 * bit)
+    directory[i] = sibling;
+
+  splitsCount++;
+}
+
+template <typename Key, typename Value, typename Hash>
+ExtendibleHashTable<Key, Value, Hash>::ExtendibleHashTable(
+    size_t initialBuckets, size_t capacity)
+    : globalDepth(0), initialDepth(0),
+      bucketCapacity(std::max<size_t>(capacity, 1)), numberOfElements(0),
+      splitsCount(0), doublingsCount(0) {
+  while ((size_t(1) << initialDepth) < initialBuckets and
+         initialDepth < MAX_DEPTH)
+    initialDepth++;
+
+  initialize(initialDepth);
+}
+
+template <typename Key, typename Value, typename Hash>
+void ExtendibleHashTable<Key, Value, Hash>::insert(const Key &key,
+                                                   const Value &value) {
+  uint64_t code = codeOf(key);
+
+  if (findEntry(key, code))
+    throw KeyAlreadyExistsException();
+
+  insertEntry(key, value, code);
+}
+
+template <typename Key, typename Value, typename Hash>
+bool ExtendibleHashTable<Key, Value, Hash>::find(const Key &key,
+                                                 Value &outValue) const {
+  const Entry *entry = findEntry(key, codeOf(key));
+
+  if (!entry)
+    return false;
+
+  outValue = entry->value;
+  return true;
+}
+
+template <typename Key, typename Value, typename Hash>
+void ExtendibleHashTable<Key, Value, Hash>::update(const Key &key,
+                                                   const Value &value) {
+  Entry *entry = findEntry(key, codeOf(key));
+
+  if (!entry)
+    throw KeyNotFoundException();
+
+  entry->value = value;
+}
+
+template <typename Key, typename Value, typename Hash>
+void ExtendibleHashTable<Key, Value, Hash>::remove(const Key &key) {
+  uint64_t code = codeOf(key);
+  Entry *entry = findEntry(key, code);
+
+  if (!entry)
+    return;
+
+  std::vector<Entry> &entries = bucketOf(code)->entries;
+  std::swap(*entry, entries.back());
+  entries.pop_back();
+  numberOfElements--;
+}
+
+template <typename Key, typename Value, typename Hash>
+void ExtendibleHashTable<Key, Value, Hash>::clear() {
+  initialize(initialDepth);
+
+  numberOfElements = 0;
+  splitsCount = 0;
+  doublingsCount = 0;
+  this->resetCounter();
+}
+
+template <typename Key, typename Value, typename Hash>
+void ExtendibleHashTable<Key, Value, Hash>::reserve(size_t n) {
+  if (numberOfElements > 0)
+    return;
+
+  size_t depth = globalDepth;
+  while (3 * n > 2 * bucketCapacity * (size_t(1) << depth) and
+         depth < MAX_DEPTH)
+    depth++;
+
+  if (depth > globalDepth)
+    initialize(depth);
+}
+
+template <typename Key, typename Value, typename Hash>
+void ExtendibleHashTable<Key, Value, Hash>::shrinkToFit() {
+  std::vector<Entry> entries;
+  entries.reserve(numberOfElements);
+
+  for (const auto &bucket : buckets)
+    std::move(bucket->entries.begin(), bucket->entries.end(),
+              std::back_inserter(entries));
+
+  numberOfElements = 0;
+  initialize(initialDepth);
+  reserve(entries.size());
+
+  for (const Entry &entry : entries)
+    insertEntry(entry.key, entry.value, entry.code);
+}
+
+template <typename Key, typename Value, typename Hash>
+void ExtendibleHashTable<Key, Value, Hash>::printInOrder(
+    std::ostream &out) const {
+  size_t maxKeyLen = 0, maxValLen = 0;
+  std::vector<std::pair<Key, Value>> vec;
+  vec.reserve(numberOfElements);
+
+  forEach([&](const Key &key, const Value &value) {
+    vec.emplace_back(key, value);
+    maxKeyLen = std::max(maxKeyLen, StringHandler::size(key));
+    maxValLen = std::max(maxValLen, StringHandler::size(value));
+  });
+
+  std::sort(vec.begin(), vec.end(),
+            [](const auto &pa, const auto &pb) { return pa.first < pb.first; });
+
+  for (const auto &p : vec) {
+    out << StringHandler::SetWidthAtLeft(p.first, maxKeyLen) << " | "
+        << StringHandler::SetWidthAtLeft(p.second, maxValLen) << "\n";
+  }
+}
+
+template <typename Key, typename Value, typename Hash>
+void ExtendibleHashTable<Key, Value, Hash>::forEach(
+    const std::function<void(const Key &, const Value &)> &action) const {
+  for (const auto &bucket : buckets)
+    for (const Entry &entry : bucket->entries)
+      action(entry.key, entry.value);
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t ExtendibleHashTable<Key, Value, Hash>::getComparisonsCount() const {
+  return this->comparisonsCount;
+}
+
+template <typename Key, typename Value, typename Hash>
+Value &ExtendibleHashTable<Key, Value, Hash>::operator[](const Key &key) {
+  uint64_t code = codeOf(key);
+  Entry *entry = findEntry(key, code);
+
+  if (!entry)
+    entry = insertEntry(key, Value(), code);
+
+  return entry->value;
+}
+
+template <typename Key, typename Value, typename Hash>
+const Value &
+ExtendibleHashTable<Key, Value, Hash>::operator[](const Key &key) const {
+  const Entry *entry = findEntry(key, codeOf(key));
+
+  if (!entry)
+    throw KeyNotFoundException();
+
+  return entry->value;
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t ExtendibleHashTable<Key, Value, Hash>::size() const {
+  return numberOfElements;
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t ExtendibleHashTable<Key, Value, Hash>::getSplitsCount() const {
+  return splitsCount;
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t ExtendibleHashTable<Key, Value, Hash>::getDoublingsCount() const {
+  return doublingsCount;
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t ExtendibleHashTable<Key, Value, Hash>::getDirectorySize() const {
+  return directory.size();
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t ExtendibleHashTable<Key, Value, Hash>::getGlobalDepth() const {
+  return globalDepth;
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t ExtendibleHashTable<Key, Value, Hash>::getBucketsCount() const {
+  return buckets.size();
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t ExtendibleHashTable<Key, Value, Hash>::getBucketCapacity() const {
+  return bucketCapacity;
+}
+
+template <typename Key, typename Value, typename Hash>
+void ExtendibleHashTable<Key, Value, Hash>::accept(
+    IDictionaryVisitor<Key, Value> &visitor) const {
+  visitor.collectMetrics(*this);
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t ExtendibleHashTable<Key, Value, Hash>::getMemoryUsage() const {
+  size_t total = sizeof(*this) + directory.capacity() * sizeof(Bucket *) +
+                 buckets.capacity() * sizeof(std::unique_ptr<Bucket>);
+
+  for (const auto &bucket : buckets)
+    total += sizeof(Bucket) + bucket->entries.capacity() * sizeof(Entry);
+
+  return total;
+}
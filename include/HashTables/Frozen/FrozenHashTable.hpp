@@ -0,0 +1,218 @@
+#ifndef FROZEN_HASH_TABLE_HPP
+#define FROZEN_HASH_TABLE_HPP
+
+#include <functional>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "Dictionary/IDictionary.hpp"
+#include "HashTables/Frozen/MinimalPerfectHash.hpp"
+
+/**
+ * @brief A read-only hash table built from a finished dictionary.
+ *
+ * The keys of the source dictionary are indexed by a MinimalPerfectHash of
+ * their hash codes, so every key has a slot of its own and no slot is left
+ * empty. The keys are stored back to back in one contiguous blob, in slot
+ * order, with their values in a parallel array. A lookup hashes the key
+ * once, reads its slot from the perfect hash and compares the key stored
+ * there, which rejects keys that were never in the dictionary.
+ *
+ * The perfect hash needs distinct codes, but a hash function may give two
+ * keys the same code (CRC-32C has only 32 bits). Keys whose code another key
+ * shares are left out of the perfect hash: they take the last slots, and a
+ * small map from code to slots finds them.
+ *
+ * Nothing can be added, changed or removed after construction: insert(),
+ * update(), remove(), clear(), increment() and the non-const operator[]
+ * throw UnsupportedOperationException.
+ *
+ * @tparam Key The type of the keys. Must be explicitly convertible to
+ * `const std::string &`.
+ * @tparam Value The type of the values.
+ * @tparam Hash The hash function to be used (defaults to std::hash<Key>).
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class FrozenHashTable : public IDictionary<Key, Value> {
+  /**
+   * @brief The slot of each key.
+   */
+  MinimalPerfectHash perfectHash;
+
+  /**
+   * @brief The slots of the keys whose hash code another key shares, by code.
+   */
+  std::unordered_multimap<uint64_t, size_t> sharedCodes;
+
+  /**
+   * @brief The bytes of every key, in slot order.
+   */
+  std::string keys;
+
+  /**
+   * @brief Where the key of each slot starts in `keys`, followed by the end
+   * of the last one.
+   */
+  std::vector<size_t> keyOffsets;
+
+  /**
+   * @brief The value of each slot.
+   */
+  std::vector<Value> values;
+
+  /**
+   * @brief Hash function object used to compute the hash codes of the keys.
+   */
+  Hash hashing;
+
+  /**
+   * @brief Returns the bytes of a key.
+   */
+  static const std::string &bytesOf(const Key &key);
+
+  /**
+   * @brief Returns the key stored in a slot.
+   */
+  std::string_view keyAt(size_t slot) const;
+
+  /**
+   * @brief Returns the slot holding a key, or size() if the key is absent.
+   */
+  size_t slotOf(const Key &key) const;
+
+public:
+  /**
+   * @brief Freezes the contents of a dictionary.
+   *
+   * @param source The dictionary to copy the keys and values from.
+   * @param gamma The level size ratio of the perfect hash (see
+   * MinimalPerfectHash).
+   */
+  explicit FrozenHashTable(
+      const IDictionary<Key, Value> &source,
+      double gamma = MinimalPerfectHash::DEFAULT_GAMMA);
+
+  FrozenHashTable(const FrozenHashTable &) = delete;
+  FrozenHashTable &operator=(const FrozenHashTable &) = delete;
+
+  /**
+   * @brief Not supported: the table is read-only.
+   *
+   * @throws UnsupportedOperationException Always.
+   */
+  void insert(const Key &key, const Value &value) override;
+
+  /**
+   * @brief Retrieves the value associated with a key.
+   *
+   * Costs one hash and one key comparison.
+   *
+   * @param key The key to look for.
+   * @param outValue Receives the value, if the key is found.
+   * @return true if the key is found; false otherwise.
+   */
+  bool find(const Key &key, Value &outValue) const override;
+
+  /**
+   * @brief Not supported: the table is read-only.
+   *
+   * @throws UnsupportedOperationException Always.
+   */
+  void update(const Key &key, const Value &value) override;
+
+  /**
+   * @brief Not supported: the table is read-only.
+   *
+   * @throws UnsupportedOperationException Always.
+   */
+  void remove(const Key &key) override;
+
+  /**
+   * @brief Not supported: the table is read-only.
+   *
+   * @throws UnsupportedOperationException Always.
+   */
+  void clear() override;
+
+  /**
+   * @brief Prints the key-value pairs ordered by key.
+   *
+   * @param out The output stream.
+   */
+  void printInOrder(std::ostream &out) const override;
+
+  /**
+   * @brief Calls a function on every key-value pair, in slot order.
+   *
+   * @param action The function called with each key and value.
+   */
+  void forEach(const std::function<void(const Key &, const Value &)> &action)
+      const override;
+
+  /**
+   * @brief Returns the key comparisons made by lookups, one per lookup.
+   */
+  size_t getComparisonsCount() const override;
+
+  /**
+   * @brief Not supported: the table is read-only.
+   *
+   * @throws UnsupportedOperationException Always.
+   */
+  Value &operator[](const Key &key) override;
+
+  /**
+   * @brief Returns the value associated with a key.
+   *
+   * @param key The key to access.
+   * @return const Value& The value of the key.
+   * @throws KeyNotFoundException If the key is not in the table.
+   */
+  const Value &operator[](const Key &key) const override;
+
+  /**
+   * @brief Not supported: the table is read-only.
+   *
+   * @throws UnsupportedOperationException Always.
+   */
+  void increment(const Key &key, const Value &amount) override;
+
+  /**
+   * @brief Returns the number of keys.
+   */
+  size_t size() const;
+
+  /**
+   * @brief Returns the number of levels of the perfect hash.
+   */
+  size_t getLevelsCount() const;
+
+  /**
+   * @brief Returns the bits used by the perfect hash per key.
+   */
+  double getBitsPerKey() const;
+
+  /**
+   * @brief Returns the number of keys left out of the perfect hash because
+   * another key shares their hash code.
+   */
+  size_t getSharedCodesCount() const;
+
+  /**
+   * @brief Accepts a visitor implementing IDictionaryVisitor interface to
+   * collect metrics or perform operations on the FrozenHashTable.
+   *
+   * @param visitor A reference to an IDictionaryVisitor<Key, Value> object that
+   * will interact with the FrozenHashTable.
+   */
+  void accept(IDictionaryVisitor<Key, Value> &visitor) const override;
+
+  size_t getMemoryUsage() const override;
+};
+
+#include "HashTables/Frozen/FrozenHashTable.impl.hpp"
+
+#endif
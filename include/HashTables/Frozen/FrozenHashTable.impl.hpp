@@ -0,0 +1,225 @@
+#include "HashTables/Frozen/FrozenHashTable.hpp"
+
+#include <algorithm>
+
+#include "Exceptions/DictionaryExceptions.hpp"
+#include "Exceptions/KeyExceptions.hpp"
+#include "Utils/Strings/StringHandler.hpp"
+
+template <typename Key, typename Value, typename Hash>
+const std::string &FrozenHashTable<Key, Value, Hash>::bytesOf(const Key &key) {
+  return static_cast<const std::string &>(key);
+}
+
+template <typename Key, typename Value, typename Hash>
+std::string_view FrozenHashTable<Key, Value, Hash>::keyAt(size_t slot) const {
+  return std::string_view(keys).substr(
+      keyOffsets[slot], keyOffsets[slot + 1] - keyOffsets[slot]);
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t FrozenHashTable<Key, Value, Hash>::slotOf(const Key &key) const {
+  uint64_t code = hashing(key);
+
+  if (!sharedCodes.empty()) {
+    auto [first, last] = sharedCodes.equal_range(code);
+
+    if (first != last) {
+      for (auto it = first; it != last; ++it) {
+        this->incrementCounter(1);
+        if (keyAt(it->second) == bytesOf(key))
+          return it->second;
+      }
+
+      return values.size();
+    }
+  }
+
+  size_t slot = perfectHash(code);
+
+  if (slot >= values.size())
+    return values.size();
+
+  this->incrementCounter(1);
+  return keyAt(slot) == bytesOf(key) ? slot : values.size();
+}
+
+template <typename Key, typename Value, typename Hash>
+FrozenHashTable<Key, Value, Hash>::FrozenHashTable(
+    const IDictionary<Key, Value> &source, double gamma) {
+  std::vector<uint64_t> codes;
+  std::vector<std::pair<Key, Value>> entries;
+
+  source.forEach([&](const Key &key, const Value &value) {
+    codes.push_back(hashing(key));
+    entries.emplace_back(key, value);
+  });
+
+  std::unordered_map<uint64_t, size_t> occurrences;
+  for (uint64_t code : codes)
+    occurrences[code]++;
+
+  std::vector<uint64_t> distinctCodes;
+  distinctCodes.reserve(codes.size());
+
+  for (uint64_t code : codes)
+    if (occurrences[code] == 1)
+      distinctCodes.push_back(code);
+
+  perfectHash = MinimalPerfectHash(distinctCodes, gamma);
+
+  // Lay the keys out in slot order, so that slot i holds the i-th key. The
+  // keys sharing a code follow the ones the perfect hash places.
+  std::vector<size_t> order(entries.size());
+  size_t nextSharedSlot = distinctCodes.size();
+
+  for (size_t i = 0; i < entries.size(); i++) {
+    if (occurrences[codes[i]] == 1) {
+      order[perfectHash(codes[i])] = i;
+    } else {
+      sharedCodes.emplace(codes[i], nextSharedSlot);
+      order[nextSharedSlot++] = i;
+    }
+  }
+
+  size_t bytes = 0;
+  for (const auto &[key, value] : entries)
+    bytes += bytesOf(key).size();
+
+  keys.reserve(bytes);
+  keyOffsets.reserve(entries.size() + 1);
+  values.reserve(entries.size());
+
+  for (size_t i : order) {
+    keyOffsets.push_back(keys.size());
+    keys += bytesOf(entries[i].first);
+    values.push_back(entries[i].second);
+  }
+
+  keyOffsets.push_back(keys.size());
+}
+
+template <typename Key, typename Value, typename Hash>
+void FrozenHashTable<Key, Value, Hash>::insert(const Key &, const Value &) {
+  throw UnsupportedOperationException();
+}
+
+template <typename Key, typename Value, typename Hash>
+bool FrozenHashTable<Key, Value, Hash>::find(const Key &key,
+                                             Value &outValue) const {
+  size_t slot = slotOf(key);
+
+  if (slot == values.size())
+    return false;
+
+  outValue = values[slot];
+  return true;
+}
+
+template <typename Key, typename Value, typename Hash>
+void FrozenHashTable<Key, Value, Hash>::update(const Key &, const Value &) {
+  throw UnsupportedOperationException();
+}
+
+template <typename Key, typename Value, typename Hash>
+void FrozenHashTable<Key, Value, Hash>::remove(const Key &) {
+  throw UnsupportedOperationException();
+}
+
+template <typename Key, typename Value, typename Hash>
+void FrozenHashTable<Key, Value, Hash>::clear() {
+  throw UnsupportedOperationException();
+}
+
+template <typename Key, typename Value, typename Hash>
+void FrozenHashTable<Key, Value, Hash>::printInOrder(std::ostream &out) const {
+  std::vector<std::pair<Key, Value>> vec;
+  vec.reserve(values.size());
+
+  size_t maxKeyLen = 0, maxValLen = 0;
+
+  forEach([&](const Key &key, const Value &value) {
+    vec.emplace_back(key, value);
+    maxKeyLen = std::max(maxKeyLen, StringHandler::size(key));
+    maxValLen = std::max(maxValLen, StringHandler::size(value));
+  });
+
+  std::sort(vec.begin(), vec.end(),
+            [](const auto &pa, const auto &pb) { return pa.first < pb.first; });
+
+  for (const auto &p : vec) {
+    out << StringHandler::SetWidthAtLeft(p.first, maxKeyLen) << " | "
+        << StringHandler::SetWidthAtLeft(p.second, maxValLen) << "\n";
+  }
+}
+
+template <typename Key, typename Value, typename Hash>
+void FrozenHashTable<Key, Value, Hash>::forEach(
+    const std::function<void(const Key &, const Value &)> &action) const {
+  for (size_t slot = 0; slot < values.size(); slot++)
+    action(Key(std::string(keyAt(slot))), values[slot]);
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t FrozenHashTable<Key, Value, Hash>::getComparisonsCount() const {
+  return this->comparisonsCount;
+}
+
+template <typename Key, typename Value, typename Hash>
+Value &FrozenHashTable<Key, Value, Hash>::operator[](const Key &) {
+  throw UnsupportedOperationException();
+}
+
+template <typename Key, typename Value, typename Hash>
+const Value &
+FrozenHashTable<Key, Value, Hash>::operator[](const Key &key) const {
+  size_t slot = slotOf(key);
+
+  if (slot == values.size())
+    throw KeyNotFoundException();
+
+  return values[slot];
+}
+
+template <typename Key, typename Value, typename Hash>
+void FrozenHashTable<Key, Value, Hash>::increment(const Key &, const Value &) {
+  throw UnsupportedOperationException();
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t FrozenHashTable<Key, Value, Hash>::size() const {
+  return values.size();
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t FrozenHashTable<Key, Value, Hash>::getLevelsCount() const {
+  return perfectHash.getLevelsCount();
+}
+
+template <typename Key, typename Value, typename Hash>
+double FrozenHashTable<Key, Value, Hash>::getBitsPerKey() const {
+  return perfectHash.getBitsPerKey();
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t FrozenHashTable<Key, Value, Hash>::getSharedCodesCount() const {
+  return sharedCodes.size();
+}
+
+template <typename Key, typename Value, typename Hash>
+void FrozenHashTable<Key, Value, Hash>::accept(
+    IDictionaryVisitor<Key, Value> &visitor) const {
+  visitor.collectMetrics(*this);
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t FrozenHashTable<Key, Value, Hash>::getMemoryUsage() const {
+  // Each shared code is a hash node holding the pair and a next pointer.
+  size_t sharedNode = sizeof(std::pair<const uint64_t, size_t>) +
+                      sizeof(void *);
+
+  return perfectHash.getMemoryUsage() + sharedCodes.size() * sharedNode +
+         sharedCodes.bucket_count() * sizeof(void *) + keys.capacity() +
+         keyOffsets.capacity() * sizeof(size_t) +
+         values.capacity() * sizeof(Value);
+}
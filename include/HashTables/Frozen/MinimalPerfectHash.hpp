@@ -0,0 +1,132 @@
+#ifndef MINIMAL_PERFECT_HASH_HPP
+#define MINIMAL_PERFECT_HASH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class MinimalPerfectHash
+ * @brief A minimal perfect hash function over a fixed set of 64-bit hash
+ * codes (Limasset et al.'s BBHash).
+ *
+ * The codes are placed in a cascade of bit arrays. At each level every
+ * remaining code is rehashed to one position of an array about gamma times
+ * as large as the number of codes left; codes alone at their position set
+ * its bit, and the ones that collided move on to the next level. The index
+ * of a code is the rank of its bit among all set bits, so the n codes map to
+ * exactly [0, n).
+ *
+ * With gamma = 1 the arrays take about e ≈ 2.72 bits per code, plus 1/16 for
+ * the rank directory. Codes still unplaced after MAX_LEVELS levels are kept
+ * in a small map.
+ */
+class MinimalPerfectHash {
+public:
+  /**
+   * @brief Default ratio between the size of a level and the codes it holds.
+   */
+  static constexpr double DEFAULT_GAMMA = 1.0;
+
+  /**
+   * @brief Number of levels tried before falling back to the map.
+   */
+  static const size_t MAX_LEVELS = 32;
+
+private:
+  /**
+   * @brief Number of words covered by each entry of the rank directory.
+   */
+  static const size_t WORDS_PER_RANK = 8;
+
+  /**
+   * @brief The bit arrays of every level, one after the other, each rounded
+   * up to a whole number of words.
+   */
+  std::vector<uint64_t> bits;
+
+  /**
+   * @brief The number of set bits before each group of WORDS_PER_RANK words.
+   */
+  std::vector<uint32_t> ranks;
+
+  /**
+   * @brief The first word of each level, followed by the end of the last one.
+   */
+  std::vector<size_t> levelOffsets;
+
+  /**
+   * @brief Indexes of the codes that no level could place.
+   */
+  std::unordered_map<uint64_t, size_t> fallback;
+
+  /**
+   * @brief The number of codes.
+   */
+  size_t codesCount;
+
+  /**
+   * @brief Derives the position of a code within a level of `words` words.
+   */
+  static size_t positionOf(uint64_t code, size_t level, size_t words);
+
+  /**
+   * @brief Returns the number of set bits before a bit.
+   */
+  size_t rank(size_t bit) const;
+
+public:
+  /**
+   * @brief Constructs the function of an empty set.
+   */
+  MinimalPerfectHash();
+
+  /**
+   * @brief Builds the function of a set of codes.
+   *
+   * @param codes The codes; must be distinct.
+   * @param gamma The ratio between the size of each level and the codes it
+   * holds. Larger values build and evaluate faster but take more space.
+   * @throws std::invalid_argument If `gamma` is below one or the codes are
+   * not distinct.
+   */
+  explicit MinimalPerfectHash(const std::vector<uint64_t> &codes,
+                              double gamma = DEFAULT_GAMMA);
+
+  /**
+   * @brief Returns the index of a code.
+   *
+   * @param code A code of the set the function was built from.
+   * @return size_t The index of the code, in [0, size()). Codes outside the
+   * set map to an arbitrary index or to size().
+   */
+  size_t operator()(uint64_t code) const;
+
+  /**
+   * @brief Returns the number of codes.
+   */
+  size_t size() const;
+
+  /**
+   * @brief Returns the number of levels.
+   */
+  size_t getLevelsCount() const;
+
+  /**
+   * @brief Returns the number of codes kept in the fallback map.
+   */
+  size_t getFallbackCount() const;
+
+  /**
+   * @brief Returns the bytes used by the function.
+   */
+  size_t getMemoryUsage() const;
+
+  /**
+   * @brief Returns the bits used by the function per code.
+   */
+  double getBitsPerKey() const;
+};
+
+#endif
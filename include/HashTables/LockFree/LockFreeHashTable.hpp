@@ -0,0 +1,331 @@
+#ifndef LOCK_FREE_HASH_TABLE_HPP
+#define LOCK_FREE_HASH_TABLE_HPP
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "Dictionary/IDictionary.hpp"
+
+/**
+ * @brief A lock-free hash table with linear probing, meant to be filled by
+ * many threads at once.
+ *
+ * A key is claimed by a compare-and-swap of its slot's key pointer from null
+ * to a freshly allocated copy of the key; a thread that loses the race reads
+ * the winner's key and either shares the slot or probes on. Values are
+ * updated with relaxed atomic operations, so counting a word is one atomic
+ * add once its slot is found.
+ *
+ * Each key is looked for in a window of at most MAX_PROBES slots. When a
+ * thread finds every slot of its window taken by other keys, it moves on to
+ * a table twice as large, installing it with another compare-and-swap if no
+ * thread has done so yet. Since slots are never released, a full window
+ * stays full, so a key that spilled over is never claimed again in an
+ * earlier table and no locks are needed to grow. Lookups walk the tables in
+ * order, so the table should be sized up front for the expected number of
+ * keys whenever possible.
+ *
+ * Keys cannot be removed: remove() throws UnsupportedOperationException.
+ *
+ * @tparam Key The type of the keys.
+ * @tparam Value The type of the values. Must be an integral type, since it
+ * is updated with atomic operations.
+ * @tparam Hash The hash function to be used (defaults to std::hash<Key>).
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class LockFreeHashTable : public IDictionary<Key, Value> {
+  static_assert(std::is_integral<Value>::value,
+                "LockFreeHashTable requires an integral value type.");
+
+public:
+  /**
+   * @brief Operation counts of the threads that used the table.
+   */
+  struct ThreadStatistics {
+    /**
+     * @brief Occupied slots inspected while probing.
+     */
+    size_t comparisons;
+
+    /**
+     * @brief Keys inserted.
+     */
+    size_t insertions;
+
+    /**
+     * @brief Compare-and-swap operations that lost a slot to another thread.
+     */
+    size_t casFailures;
+  };
+
+  /**
+   * @brief Default number of slots of the first table.
+   */
+  static const size_t DEFAULT_CAPACITY = 1024;
+
+  /**
+   * @brief Maximum number of slots probed per key in each table.
+   */
+  static const size_t MAX_PROBES = 32;
+
+  /**
+   * @brief Number of distinct per-thread counter slots.
+   */
+  static const size_t MAX_THREADS = 64;
+
+private:
+  /**
+   * @brief A key together with its hash code, allocated once per key.
+   */
+  struct KeyNode {
+    uint64_t code;
+    Key key;
+  };
+
+  /**
+   * @brief A slot: null until a key claims it, then fixed for good.
+   */
+  struct Slot {
+    std::atomic<const KeyNode *> key{nullptr};
+    Value value{};
+  };
+
+  /**
+   * @brief An array of slots, followed by the table keys spill over to.
+   */
+  struct Table {
+    size_t capacity;
+    std::unique_ptr<Slot[]> slots;
+    std::atomic<Table *> next{nullptr};
+
+    explicit Table(size_t size)
+        : capacity(size), slots(std::make_unique<Slot[]>(size)) {}
+  };
+
+  /**
+   * @brief Per-thread counters, aligned to a cache line to avoid false
+   * sharing between threads.
+   */
+  struct alignas(64) ThreadCounters {
+    std::atomic<size_t> comparisons{0};
+    std::atomic<size_t> insertions{0};
+    std::atomic<size_t> casFailures{0};
+  };
+
+  /**
+   * @brief The first table.
+   */
+  Table *head;
+
+  /**
+   * @brief The number of slots of the first table.
+   */
+  size_t initialCapacity;
+
+  /**
+   * @brief The number of keys stored.
+   */
+  mutable std::atomic<size_t> numberOfElements;
+
+  /**
+   * @brief The number of tables allocated.
+   */
+  mutable std::atomic<size_t> tablesCount;
+
+  /**
+   * @brief The counters of each thread.
+   */
+  mutable std::array<ThreadCounters, MAX_THREADS> counters;
+
+  /**
+   * @brief Hash function object used to compute the hash codes of the keys.
+   */
+  Hash hashing;
+
+  /**
+   * @brief Returns the counters slot of the calling thread.
+   */
+  static size_t threadSlot();
+
+  /**
+   * @brief Returns the hash code of a key, mixed so that its low bits can
+   * index a table.
+   */
+  uint64_t codeOf(const Key &key) const;
+
+  /**
+   * @brief Returns the table following `table`, installing a new one twice
+   * as large if there is none yet.
+   */
+  Table *grow(Table *table) const;
+
+  /**
+   * @brief Finds the slot of a key.
+   *
+   * @param key The key to look for.
+   * @param create Whether to claim a slot for the key if it is absent.
+   * @param inserted Set to true if the slot was claimed by this call.
+   * @return Slot* The slot of the key, or nullptr if it is absent and
+   * `create` is false.
+   */
+  Slot *locate(const Key &key, bool create, bool &inserted) const;
+
+  /**
+   * @brief Frees every table and key.
+   */
+  void releaseTables();
+
+public:
+  /**
+   * @brief Constructs an empty table.
+   *
+   * @param capacity The number of slots of the first table, rounded up to a
+   * power of two.
+   */
+  explicit LockFreeHashTable(size_t capacity = DEFAULT_CAPACITY);
+
+  LockFreeHashTable(const LockFreeHashTable &) = delete;
+  LockFreeHashTable &operator=(const LockFreeHashTable &) = delete;
+
+  ~LockFreeHashTable();
+
+  /**
+   * @brief Inserts a key-value pair. Thread-safe.
+   *
+   * @param key The key to be inserted.
+   * @param value The value associated with the key.
+   * @throws KeyAlreadyExistsException If the key is already present.
+   */
+  void insert(const Key &key, const Value &value) override;
+
+  /**
+   * @brief Searches for a key and retrieves its value if found. Thread-safe.
+   *
+   * @param key The key to search for.
+   * @param outValue Receives the value of the key, if found.
+   * @return true if the key is found; false otherwise.
+   */
+  bool find(const Key &key, Value &outValue) const override;
+
+  /**
+   * @brief Replaces the value of an existing key. Thread-safe.
+   *
+   * @param key The key to be updated.
+   * @param value The new value.
+   * @throws KeyNotFoundException If the key is not present.
+   */
+  void update(const Key &key, const Value &value) override;
+
+  /**
+   * @brief Not supported: slots are never released.
+   *
+   * @throws UnsupportedOperationException Always.
+   */
+  void remove(const Key &key) override;
+
+  /**
+   * @brief Removes every key and resets the statistics. Not thread-safe.
+   */
+  void clear() override;
+
+  /**
+   * @brief Prints the key-value pairs ordered by key.
+   *
+   * @param out The output stream.
+   */
+  void printInOrder(std::ostream &out) const override;
+
+  /**
+   * @brief Calls a function on every key-value pair, in no particular order.
+   *
+   * @param action The function called with each key and value.
+   */
+  void forEach(const std::function<void(const Key &, const Value &)> &action)
+      const override;
+
+  /**
+   * @brief Returns the occupied slots inspected by all threads.
+   */
+  size_t getComparisonsCount() const override;
+
+  /**
+   * @brief Returns a reference to the value of a key, inserting a
+   * default-constructed value if the key is not present.
+   *
+   * The reference stays valid until the table is cleared, but writes through
+   * it are not atomic; use increment() to count concurrently.
+   *
+   * @param key The key to access.
+   * @return Value& A reference to the value.
+   */
+  Value &operator[](const Key &key) override;
+
+  /**
+   * @brief Returns a const reference to the value of a key.
+   *
+   * @param key The key to access.
+   * @return const Value& A reference to the value.
+   * @throws KeyNotFoundException If the key is not present.
+   */
+  const Value &operator[](const Key &key) const override;
+
+  /**
+   * @brief Adds an amount to the value of a key with one atomic add,
+   * claiming a slot for the key first if needed.
+   *
+   * @param key The key whose value is incremented.
+   * @param amount The amount to add.
+   */
+  void increment(const Key &key, const Value &amount) override;
+
+  /**
+   * @brief Always true: every operation is lock-free.
+   */
+  bool isThreadSafe() const override;
+
+  /**
+   * @brief Returns the number of keys stored.
+   */
+  size_t size() const;
+
+  /**
+   * @brief Returns the number of tables allocated, the first one included.
+   */
+  size_t getTablesCount() const;
+
+  /**
+   * @brief Returns the number of slots of all tables.
+   */
+  size_t getCapacity() const;
+
+  /**
+   * @brief Returns the compare-and-swap failures of all threads.
+   */
+  size_t getCasFailuresCount() const;
+
+  /**
+   * @brief Returns the counters of every thread that used the table.
+   */
+  std::vector<ThreadStatistics> getThreadStatistics() const;
+
+  /**
+   * @brief Accepts a visitor implementing IDictionaryVisitor interface to
+   * collect metrics or perform operations on the LockFreeHashTable.
+   *
+   * @param visitor A reference to an IDictionaryVisitor<Key, Value> object that
+   * will interact with the LockFreeHashTable.
+   */
+  void accept(IDictionaryVisitor<Key, Value> &visitor) const override;
+
+  size_t getMemoryUsage() const override;
+};
+
+#include "HashTables/LockFree/LockFreeHashTable.impl.hpp"
+
+#endif
@@ -0,0 +1,337 @@
+#include "HashTables/LockFree/LockFreeHashTable.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#include "Exceptions/DictionaryExceptions.hpp"
+#include "Exceptions/KeyExceptions.hpp"
+#include "Utils/Strings/StringHandler.hpp"
+
+template <typename Key, typename Value, typename Hash>
+size_t LockFreeHashTable<Key, Value, Hash>::threadSlot() {
+  static std::atomic<size_t> nextSlot{0};
+  thread_local size_t slot =
+      nextSlot.fetch_add(1, std::memory_order_relaxed) % MAX_THREADS;
+  return slot;
+}
+
+template <typename Key, typename Value, typename Hash>
+uint64_t LockFreeHashTable<Key, Value, Hash>::codeOf(const Key &key) const {
+  uint64_t h = hashing(key);
+  h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+  return h ^ (h >> 31);
+}
+
+template <typename Key, typename Value, typename Hash>
+typename LockFreeHashTable<Key, Value, Hash>::Table *
+LockFreeHashTable<Key, Value, Hash>::grow(Table *table) const {
+  Table *next = table->next.load(std::memory_order_acquire);
+
+  if (next)
+    return next;
+
+  Table *fresh = new Table(table->capacity * 2);
+
+  if (table->next.compare_exchange_strong(next, fresh,
+                                          std::memory_order_acq_rel)) {
+    tablesCount.fetch_add(1, std::memory_order_relaxed);
+    return fresh;
+  }
+
+  // Another thread installed its table first.
+  delete fresh;
+  return next;
+}
+
+template <typename Key, typename Value, typename Hash>
+typename LockFreeHashTable<Key, Value, Hash>::Slot *
+LockFreeHashTable<Key, Value, Hash>::locate(const Key &key, bool create,
+                                            bool &inserted) const {
+  ThreadCounters &stats = counters[threadSlot()];
+  uint64_t code = codeOf(key);
+  KeyNode *node = nullptr;
+  Slot *found = nullptr;
+  size_t comparisons = 0;
+
+  inserted = false;
+
+  for (Table *table = head; table and !found;) {
+    size_t mask = table->capacity - 1;
+    size_t probes =
+        table->capacity < MAX_PROBES ? table->capacity : MAX_PROBES;
+    bool absent = false;
+
+    for (size_t i = 0; i < probes and !found; i++) {
+      Slot &slot = table->slots[(code + i) & mask];
+      const KeyNode *current = slot.key.load(std::memory_order_acquire);
+
+      if (!current) {
+        if (!create) {
+          absent = true;
+          break;
+        }
+
+        if (!node)
+          node = new KeyNode{code, key};
+
+        if (slot.key.compare_exchange_strong(current, node,
+                                             std::memory_order_acq_rel)) {
+          numberOfElements.fetch_add(1, std::memory_order_relaxed);
+          stats.insertions.fetch_add(1, std::memory_order_relaxed);
+          inserted = true;
+          found = &slot;
+          node = nullptr;
+          break;
+        }
+
+        // Another thread claimed the slot; `current` now holds its key.
+        stats.casFailures.fetch_add(1, std::memory_order_relaxed);
+      }
+
+      comparisons++;
+      if (current->code == code and current->key == key)
+        found = &slot;
+    }
+
+    // An empty slot in the window means the key was never placed further.
+    if (absent)
+      break;
+
+    if (!found)
+      table = create ? grow(table)
+                     : table->next.load(std::memory_order_acquire);
+  }
+
+  delete node;
+  stats.comparisons.fetch_add(comparisons, std::memory_order_relaxed);
+
+  return found;
+}
+
+template <typename Key, typename Value, typename Hash>
+void LockFreeHashTable<Key, Value, Hash>::releaseTables() {
+  Table *table = head;
+
+  while (table) {
+    for (size_t i = 0; i < table->capacity; i++)
+      delete table->slots[i].key.load(std::memory_order_relaxed);
+
+    Table *next = table->next.load(std::memory_order_relaxed);
+    delete table;
+    table = next;
+  }
+
+  head = nullptr;
+}
+
+template <typename Key, typename Value, typename Hash>
+LockFreeHashTable<Key, Value, Hash>::LockFreeHashTable(size_t capacity)
+    : head(nullptr), initialCapacity(1), numberOfElements(0), tablesCount(1) {
+  while (initialCapacity < capacity)
+    initialCapacity <<= 1;
+
+  head = new Table(initialCapacity);
+}
+
+template <typename Key, typename Value, typename Hash>
+LockFreeHashTable<Key, Value, Hash>::~LockFreeHashTable() {
+  releaseTables();
+}
+
+template <typename Key, typename Value, typename Hash>
+void LockFreeHashTable<Key, Value, Hash>::insert(const Key &key,
+                                                 const Value &value) {
+  bool inserted;
+  Slot *slot = locate(key, true, inserted);
+
+  if (!inserted)
+    throw KeyAlreadyExistsException();
+
+  // Other threads may already be incrementing the new key.
+  __atomic_fetch_add(&slot->value, value, __ATOMIC_RELAXED);
+}
+
+template <typename Key, typename Value, typename Hash>
+bool LockFreeHashTable<Key, Value, Hash>::find(const Key &key,
+                                               Value &outValue) const {
+  bool inserted;
+  Slot *slot = locate(key, false, inserted);
+
+  if (!slot)
+    return false;
+
+  outValue = __atomic_load_n(&slot->value, __ATOMIC_RELAXED);
+  return true;
+}
+
+template <typename Key, typename Value, typename Hash>
+void LockFreeHashTable<Key, Value, Hash>::update(const Key &key,
+                                                 const Value &value) {
+  bool inserted;
+  Slot *slot = locate(key, false, inserted);
+
+  if (!slot)
+    throw KeyNotFoundException();
+
+  __atomic_store_n(&slot->value, value, __ATOMIC_RELAXED);
+}
+
+template <typename Key, typename Value, typename Hash>
+void LockFreeHashTable<Key, Value, Hash>::remove(const Key &) {
+  throw UnsupportedOperationException();
+}
+
+template <typename Key, typename Value, typename Hash>
+void LockFreeHashTable<Key, Value, Hash>::clear() {
+  releaseTables();
+  head = new Table(initialCapacity);
+
+  numberOfElements = 0;
+  tablesCount = 1;
+
+  for (ThreadCounters &slot : counters) {
+    slot.comparisons = 0;
+    slot.insertions = 0;
+    slot.casFailures = 0;
+  }
+}
+
+template <typename Key, typename Value, typename Hash>
+void LockFreeHashTable<Key, Value, Hash>::printInOrder(
+    std::ostream &out) const {
+  size_t maxKeyLen = 0, maxValLen = 0;
+  std::vector<std::pair<Key, Value>> vec;
+  vec.reserve(size());
+
+  forEach([&](const Key &key, const Value &value) {
+    vec.emplace_back(key, value);
+    maxKeyLen = std::max(maxKeyLen, StringHandler::size(key));
+    maxValLen = std::max(maxValLen, StringHandler::size(value));
+  });
+
+  std::sort(vec.begin(), vec.end(),
+            [](const auto &pa, const auto &pb) { return pa.first < pb.first; });
+
+  for (const auto &p : vec) {
+    out << StringHandler::SetWidthAtLeft(p.first, maxKeyLen) << " | "
+        << StringHandler::SetWidthAtLeft(p.second, maxValLen) << "\n";
+  }
+}
+
+template <typename Key, typename Value, typename Hash>
+void LockFreeHashTable<Key, Value, Hash>::forEach(
+    const std::function<void(const Key &, const Value &)> &action) const {
+  for (const Table *table = head; table;
+       table = table->next.load(std::memory_order_acquire)) {
+    for (size_t i = 0; i < table->capacity; i++) {
+      const Slot &slot = table->slots[i];
+      const KeyNode *node = slot.key.load(std::memory_order_acquire);
+
+      if (node)
+        action(node->key, __atomic_load_n(&slot.value, __ATOMIC_RELAXED));
+    }
+  }
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t LockFreeHashTable<Key, Value, Hash>::getComparisonsCount() const {
+  size_t total = 0;
+
+  for (const ThreadCounters &slot : counters)
+    total += slot.comparisons.load(std::memory_order_relaxed);
+
+  return total;
+}
+
+template <typename Key, typename Value, typename Hash>
+Value &LockFreeHashTable<Key, Value, Hash>::operator[](const Key &key) {
+  bool inserted;
+  return locate(key, true, inserted)->value;
+}
+
+template <typename Key, typename Value, typename Hash>
+const Value &
+LockFreeHashTable<Key, Value, Hash>::operator[](const Key &key) const {
+  bool inserted;
+  const Slot *slot = locate(key, false, inserted);
+
+  if (!slot)
+    throw KeyNotFoundException();
+
+  return slot->value;
+}
+
+template <typename Key, typename Value, typename Hash>
+void LockFreeHashTable<Key, Value, Hash>::increment(const Key &key,
+                                                    const Value &amount) {
+  bool inserted;
+  Slot *slot = locate(key, true, inserted);
+  __atomic_fetch_add(&slot->value, amount, __ATOMIC_RELAXED);
+}
+
+template <typename Key, typename Value, typename Hash>
+bool LockFreeHashTable<Key, Value, Hash>::isThreadSafe() const {
+  return true;
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t LockFreeHashTable<Key, Value, Hash>::size() const {
+  return numberOfElements.load(std::memory_order_relaxed);
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t LockFreeHashTable<Key, Value, Hash>::getTablesCount() const {
+  return tablesCount.load(std::memory_order_relaxed);
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t LockFreeHashTable<Key, Value, Hash>::getCapacity() const {
+  size_t total = 0;
+
+  for (const Table *table = head; table;
+       table = table->next.load(std::memory_order_acquire))
+    total += table->capacity;
+
+  return total;
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t LockFreeHashTable<Key, Value, Hash>::getCasFailuresCount() const {
+  size_t total = 0;
+
+  for (const ThreadCounters &slot : counters)
+    total += slot.casFailures.load(std::memory_order_relaxed);
+
+  return total;
+}
+
+template <typename Key, typename Value, typename Hash>
+std::vector<typename LockFreeHashTable<Key, Value, Hash>::ThreadStatistics>
+LockFreeHashTable<Key, Value, Hash>::getThreadStatistics() const {
+  std::vector<ThreadStatistics> statistics;
+
+  for (const ThreadCounters &slot : counters) {
+    ThreadStatistics entry = {
+        slot.comparisons.load(std::memory_order_relaxed),
+        slot.insertions.load(std::memory_order_relaxed),
+        slot.casFailures.load(std::memory_order_relaxed)};
+
+    if (entry.comparisons or entry.insertions or entry.casFailures)
+      statistics.push_back(entry);
+  }
+
+  return statistics;
+}
+
+template <typename Key, typename Value, typename Hash>
+void LockFreeHashTable<Key, Value, Hash>::accept(
+    IDictionaryVisitor<Key, Value> &visitor) const {
+  visitor.collectMetrics(*this);
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t LockFreeHashTable<Key, Value, Hash>::getMemoryUsage() const {
+  return sizeof(*this) + getCapacity() * sizeof(Slot) +
+         getTablesCount() * sizeof(Table) + size() * sizeof(KeyNode);
+}
@@ -5,112 +5,210 @@
 
 #include "Dictionary/IDictionary.hpp"
 #include "HashTables/Base/BaseHashTable.hpp"
+#include "HashTables/OpenAddressing/ProbingPolicies.hpp"
 #include "HashTables/OpenAddressing/Slot.hpp"
 
 /**
  * @brief Hash table implementation using open addressing.
  *
+ * The slots are stored as a structure of arrays: the control bytes of every
+ * slot (see SlotControl) in the `table` of BaseHashTable, then the keys, then
+ * the values, then the hash codes of the keys, each in a vector of its own.
+ * A probe runs through the control bytes alone and reaches for a key only on
+ * a fingerprint match, instead of pulling a whole key-value pair into the
+ * cache for each slot it visits. The key itself is compared only if the full
+ * hash codes match as well, and rehashes and compactions place the keys by
+ * their stored codes without hashing them again.
+ *
+ * A removed key leaves a DELETED mark (a tombstone) in its slot, so that the
+ * probe sequences running through the slot still reach the keys past it.
+ * Tombstones are reused by later insertions, but they lengthen every probe
+ * that crosses them, so once they take more than MAX_DELETED_RATIO of the
+ * slots, the table is rebuilt in place without them.
+ *
+ * Every lookup counts its probes and the cache lines it touches: each
+ * line of control bytes the probe sequence enters, and one line for each
+ * hash code and each key it reads. The lines are an estimate of the cache
+ * misses of a lookup, as neither the lines shared with earlier lookups nor
+ * the characters of the keys are told apart.
+ *
  * @tparam Key The type of the keys.
  * @tparam Value The type of the values.
  * @tparam Hash The hash function to be used (defaults to std::hash<Key>).
+ * @tparam ProbingPolicy Chooses the probe sequence (see
+ * ProbingPolicies.hpp).
  */
-template <typename Key, typename Value, typename Hash = std::hash<Key>>
+template <typename Key, typename Value, typename Hash = std::hash<Key>,
+          typename ProbingPolicy = QuadraticProbing>
 class OpenAddressingHashTable
     : public IDictionary<Key, Value>,
-      public BaseHashTable<OpenAddressingHashTable<Key, Value, Hash>,
-                           Slot<Key, Value>, Key, Value, Hash> {
+      public BaseHashTable<
+          OpenAddressingHashTable<Key, Value, Hash, ProbingPolicy>, uint8_t,
+          Key, Value, Hash> {
+public:
+  /**
+   * @brief Fraction of the slots that may hold tombstones before the table
+   * is compacted.
+   */
+  static constexpr float MAX_DELETED_RATIO = 0.1f;
+
+  /**
+   * @brief The size of a cache line, in bytes, for the count of the lines
+   * touched by the lookups.
+   */
+  static constexpr size_t CACHE_LINE_SIZE = 64;
+
 private:
+  /**
+   * @brief The number of DELETED slots of the current table. Those of the
+   * old table of a rehash are not counted, as it is dropped whole.
+   */
+  size_t deletedCount;
+
+  /**
+   * @brief The number of times the table was compacted.
+   */
+  size_t compactionsCount;
+
+  /**
+   * @brief The number of lookups made (searches of a key).
+   */
+  mutable size_t lookupsCount;
+
+  /**
+   * @brief The number of probes made by the lookups: slots read, or groups
+   * of slots with a policy scanning groups.
+   */
+  mutable size_t probesCount;
+
+  /**
+   * @brief The number of cache lines touched by the lookups.
+   */
+  mutable size_t cacheLinesCount;
+
+  /**
+   * @brief The key of each slot, meaningful where the control byte in
+   * `table` is active.
+   */
+  std::vector<Key> keys;
+
+  /**
+   * @brief The value of each slot, meaningful where the control byte in
+   * `table` is active.
+   */
+  std::vector<Value> values;
+
+  /**
+   * @brief The hash code of the key of each slot, meaningful where the
+   * control byte in `table` is active.
+   */
+  std::vector<size_t> hashes;
+
+  /**
+   * @brief The keys of the old table of an incremental rehash.
+   */
+  std::vector<Key> oldKeys;
+
+  /**
+   * @brief The values of the old table of an incremental rehash.
+   */
+  std::vector<Value> oldValues;
+
+  /**
+   * @brief The hash codes of the old table of an incremental rehash.
+   */
+  std::vector<size_t> oldHashes;
+
+  /**
+   * @brief Index returned by the searches when there is no such slot.
+   */
+  static constexpr size_t NOT_FOUND = static_cast<size_t>(-1);
+
   /**
    * @brief Result of a probing operation in open addressing.
-   *
-   * @tparam Entry Type of the slot being probed.
    */
-  template <typename Entry> struct GenericFindResult {
+  struct FindResult {
+    /**
+     * @brief The index of the slot holding the key, or NOT_FOUND.
+     */
+    size_t slot;
+
     /**
-     * @brief Pointer to the slot where the key was found (or where the search
-     * ended).
+     * @brief The index of the first available (empty or deleted) slot of the
+     * current table met during probing, or NOT_FOUND.
      */
-    Entry *slot;
+    size_t availableSlot;
 
     /**
-     * @brief Pointer to the first available (empty or deleted) slot encountered
-     * during probing.
+     * @brief Whether `slot` belongs to the old table of an incremental
+     * rehash.
      */
-    Entry *availableSlot;
+    bool inOldTable;
 
     /**
-     * @brief Constructs a GenericFindResult with the given slot and optional
-     * available slot.
-     *
-     * @param e Pointer to the slot where the key was found (or search ended).
-     * @param as Pointer to the first available slot (optional, may be nullptr).
+     * @brief The number of slots holding other keys met during probing.
      */
-    GenericFindResult(Entry *e, Entry *as = nullptr);
+    size_t collisions;
 
     /**
      * @brief Checks whether the element was found in the table.
-     *
-     * @return true if the slot pointer is not null and refers to a valid
-     * element.
      */
     bool wasElementFound() const;
   };
 
   /**
-   * @brief Result type used when performing mutable find operations.
+   * @brief Computes the index of the i-th probe of a hash code in a table of
+   * `size` slots, as ProbingPolicy does.
+   *
+   * @param hash The hash code of the key.
+   * @param i The probe number.
+   * @param size The number of slots, a power of two.
+   * @return The index of the slot.
    */
-  using FindResult = GenericFindResult<Slot<Key, Value>>;
+  size_t probe(size_t hash, size_t i, size_t size) const;
 
   /**
-   * @brief Result type used when performing read-only find operations.
+   * @brief Tells whether a slot whose fingerprint matches holds the key,
+   * comparing the stored hash code first and then the key.
    */
-  using ConstFindResult = GenericFindResult<const Slot<Key, Value>>;
+  bool holdsKey(const std::vector<Key> &slotKeys,
+                const std::vector<size_t> &codes, size_t index, const Key &key,
+                size_t hash) const;
 
   /**
-   * @brief Computes the hash code for a given key and probe number.
-   *
-   * This function generates a hash code using a combination of the primary hash
-   * function and quadratic probing. The quadratic probing formula ensures that
-   * collisions are resolved by probing different slots in the hash table.
-   *
-   * @param key The key for which the hash code is to be computed.
-   * @param i The probe number, used to calculate the offset for quadratic
-   * probing.
-   * @return The computed hash code, which is the index in the hash table.
+   * @brief Runs the probe sequence of a key in the current or the old table.
+   *
+   * Only the control bytes are read along the probe sequence, one by one or
+   * a group at a time as ProbingPolicy says, and a key is compared only when
+   * its slot has the fingerprint of `hash` and its stored hash code is
+   * `hash`.
+   *
+   * @param controls The control bytes of the table.
+   * @param slotKeys The keys of the table.
+   * @param codes The hash codes of the table.
+   * @param key The key to search for.
+   * @param hash The hash code of the key.
+   * @param availableSlot Set to the first empty or deleted slot met, unless
+   * it already holds a slot.
+   * @param collisions Increased by the number of slots holding other keys
+   * met.
+   * @return The index of the key's slot, or NOT_FOUND.
    */
-  size_t hashCode(const Key &key, size_t i) const;
+  size_t search(const std::vector<uint8_t> &controls,
+                const std::vector<Key> &slotKeys,
+                const std::vector<size_t> &codes, const Key &key, size_t hash,
+                size_t &availableSlot, size_t &collisions) const;
 
   /**
-   * @brief Searches for a constant slot in the hash table that matches the
-   * given key.
-   *
-   * This method performs a search for the specified key in the hash table using
-   * the open addressing technique. It returns a result containing a pointer to
-   * the slot if the key is found, or a null pointer if the key is not present
-   * in the table.
+   * @brief Searches for a key in the table and, while it is being rehashed,
+   * in the old table.
    *
-   * @param key The key to search for in the hash table.
-   * @return ConstFindResult A result object containing a pointer to the slot if
-   * found, or a null pointer if the key is not present.
+   * @param key The key to search for.
+   * @param hash The hash code of the key.
+   * @return FindResult Where the key is, and where it could be inserted in
+   * the current table.
    */
-  ConstFindResult findConstSlot(const Key &key) const;
-
-  /**
-   * @brief Finds a slot in the hash table for the given key.
-   *
-   * This method searches for a slot in the hash table that corresponds to the
-   * specified key. It returns a FindResult object containing pointers to the
-   * slot where the key is found (if it exists) and the first available slot (if
-   * any). The search uses open addressing with quadratic probing.
-   *
-   * @param key The key to search for in the hash table.
-   * @return FindResult A structure containing:
-   *         - A pointer to the slot where the key is found (if it exists), or
-   * nullptr otherwise.
-   *         - A pointer to the first available slot (if any), or nullptr if no
-   * available slot is found.
-   */
-  FindResult findSlot(const Key &key);
+  FindResult findSlot(const Key &key, size_t hash) const;
 
   /**
    * @brief Calculates the next power of 2 greater than or equal to the given
@@ -127,6 +225,56 @@ private:
    */
   size_t nextBase2Of(size_t m) const;
 
+  /**
+   * @brief Stores a new key in an available slot of the current table.
+   *
+   * @param index The index of the slot, empty or deleted.
+   * @param key The key.
+   * @param value The value.
+   * @param hash The hash code of the key.
+   */
+  void place(size_t index, const Key &key, const Value &value, size_t hash);
+
+  /**
+   * @brief Moves the key in a slot of the old table, if any, to the current
+   * table, leaving a deleted mark behind so that the probe sequences of the
+   * keys not migrated yet still run through the slot.
+   *
+   * The keys, values and hash codes of the old table are released after its
+   * last slot is migrated.
+   *
+   * @param index The index of the slot in the old table.
+   * @return size_t The number of pairs moved (0 or 1).
+   */
+  size_t migrate(size_t index);
+
+  /**
+   * @brief Starts a rehash to a table of `size` slots, which holds no
+   * tombstones yet, moving the keys, values and hash codes aside along with
+   * the control bytes.
+   */
+  void startRehash(size_t size);
+
+  /**
+   * @brief Turns every tombstone of the table into an empty slot and moves
+   * each key to the first slot of its probe sequence that is free, without
+   * allocating a new table.
+   *
+   * Every key's control byte is first set to DELETED, which no longer means a
+   * tombstone.
+   * Then, slot by slot, each marked key goes to the first slot of its probe
+   * sequence holding neither a key already placed nor, unless it is its own,
+   * nothing else: an empty slot takes it, and a marked slot is swapped with
+   * it, the key swapped out being placed next. The slots before a placed key
+   * in its probe sequence all hold placed keys, which never move again, so
+   * every lookup still finds it. The table must not be rehashing.
+   */
+  void compact();
+
+  friend class BaseHashTable<
+      OpenAddressingHashTable<Key, Value, Hash, ProbingPolicy>, uint8_t, Key,
+      Value, Hash>;
+
 public:
   /**
    * @brief Constructs an OpenAddressingHashTable with a specified initial size
@@ -190,11 +338,20 @@ public:
    *
    * If the key is found in the hash table, the corresponding slot's status is
    * marked as DELETED. If the key is not found, the function does nothing.
+   * The table is compacted when its tombstones exceed MAX_DELETED_RATIO of
+   * its slots.
    *
    * @param key The key of the element to be removed.
    */
   void remove(const Key &key);
 
+  /**
+   * @brief Shrinks the table to the smallest power of two that fits its keys
+   * under the maximum load factor, or, if it already has that size, compacts
+   * it to drop its tombstones.
+   */
+  void shrinkToFit();
+
   /**
    * @brief Clears the hash table by removing all elements and resetting its
    * state.
@@ -219,6 +376,14 @@ public:
    */
   void printInOrder(std::ostream &out) const;
 
+  /**
+   * @brief Calls a function on every key-value pair, in no particular order.
+   *
+   * @param action The function called with each key and value.
+   */
+  void forEach(const std::function<void(const Key &, const Value &)> &action)
+      const;
+
   /**
    * @brief Retrieves the total number of comparisons made during hash table
    * operations.
@@ -263,6 +428,27 @@ public:
    */
   const Value &operator[](const Key &key) const;
 
+  /**
+   * @brief Adds every key-value pair of another dictionary to this table.
+   *
+   * The table is first grown once to hold the keys of both dictionaries
+   * without exceeding the maximum load factor, and the rehash is completed,
+   * so the pairs of `other` are then incremented in turn without the table
+   * growing or migrating slots. When `other` is this table, every value is
+   * doubled in place instead.
+   *
+   * @param other The dictionary to merge from.
+   */
+  void mergeFrom(const IDictionary<Key, Value> &other);
+
+  /**
+   * @brief Grows the table to the smallest power of two in which `n` keys fit
+   * under the maximum load factor.
+   *
+   * @param n The number of keys to make room for.
+   */
+  void reserve(size_t n);
+
   /**
    * @brief Resizes the hash table to a new size and rehashes all existing
    * elements.
@@ -272,6 +458,10 @@ public:
    * elements into the new table. The rehashing process ensures that the hash
    * table maintains its integrity and performance after resizing.
    *
+   * The elements are moved incrementally: the old table is kept alongside the
+   * new one, lookups search both, and each following insertion migrates a few
+   * of its slots, so that no single operation pays for the whole resize.
+   *
    * @param m The new size of the hash table. Must be greater than the current
    * table size.
    */
@@ -284,7 +474,9 @@ public:
    * A collision occurs when two different keys are hashed to the same index in
    * the table. This function provides a count of such collisions, which can be
    * useful for analyzing the efficiency of the hash function and the overall
-   * performance of the hash table.
+   * performance of the hash table. The occupied slots probed past are counted
+   * by insert(), and by operator[] when it adds a new key; the moves of a
+   * rehash are not counted.
    *
    * @return size_t The number of collisions that have occurred.
    */
@@ -301,6 +493,40 @@ public:
    */
   size_t getTableSize() const;
 
+  /**
+   * @brief Returns the number of tombstones of the table.
+   */
+  size_t getDeletedCount() const;
+
+  /**
+   * @brief Returns the number of times the table was compacted.
+   */
+  size_t getCompactionsCount() const;
+
+  /**
+   * @brief Returns the number of lookups made.
+   */
+  size_t getLookupsCount() const;
+
+  /**
+   * @brief Returns the number of probes made by the lookups.
+   */
+  size_t getProbesCount() const;
+
+  /**
+   * @brief Returns the number of cache lines touched by the lookups.
+   */
+  size_t getCacheLinesCount() const;
+
+  /**
+   * @brief Returns how many keys sit at each position of their probe
+   * sequence: the k-th element counts the keys found by the (k+1)-th probe.
+   *
+   * The keys still in the old table during an incremental rehash are
+   * included, with their positions in it. Takes a walk over the whole table.
+   */
+  std::vector<size_t> getProbeLengthHistogram() const;
+
   /**
    * @brief Prints all slots in the hash table, including empty and deleted
    * ones.
@@ -2,88 +2,260 @@
 
 #include <algorithm>
 #include <iostream>
+#include <utility>
 
 #include "Exceptions/KeyExceptions.hpp"
 
-template <typename Key, typename Value, typename Hash>
-template <typename Entry>
-OpenAddressingHashTable<Key, Value, Hash>::GenericFindResult<
-    Entry>::GenericFindResult(Entry *e, Entry *as)
-    : slot(e), availableSlot(as) {}
-
-template <typename Key, typename Value, typename Hash>
-template <typename Entry>
-bool OpenAddressingHashTable<Key, Value, Hash>::GenericFindResult<
-    Entry>::wasElementFound() const {
-  return slot != nullptr;
+template <typename Key, typename Value, typename Hash, typename ProbingPolicy>
+bool OpenAddressingHashTable<Key, Value, Hash,
+                             ProbingPolicy>::FindResult::wasElementFound()
+    const {
+  return slot != NOT_FOUND;
 }
 
-template <typename Key, typename Value, typename Hash>
-size_t OpenAddressingHashTable<Key, Value, Hash>::hashCode(const Key &key,
-                                                           size_t i) const {
-  return (this->hashing(key) + ((i + (i * i)) / 2)) % this->tableSize;
+template <typename Key, typename Value, typename Hash, typename ProbingPolicy>
+size_t OpenAddressingHashTable<Key, Value, Hash, ProbingPolicy>::probe(
+    size_t hash, size_t i, size_t size) const {
+  return ProbingPolicy::probe(hash, i, size);
 }
 
-template <typename Key, typename Value, typename Hash>
-typename OpenAddressingHashTable<Key, Value, Hash>::ConstFindResult
-OpenAddressingHashTable<Key, Value, Hash>::findConstSlot(const Key &key) const {
-  const Slot<Key, Value> *tableSlot = nullptr;
+template <typename Key, typename Value, typename Hash, typename ProbingPolicy>
+bool OpenAddressingHashTable<Key, Value, Hash, ProbingPolicy>::holdsKey(
+    const std::vector<Key> &slotKeys, const std::vector<size_t> &codes,
+    size_t index, const Key &key, size_t hash) const {
+  this->incrementCounter(1);
+  cacheLinesCount++;
+
+  if (codes[index] != hash)
+    return false;
+
+  cacheLinesCount++;
+  return slotKeys[index] == key;
+}
 
-  for (size_t i = 0; i < this->tableSize; i++) {
-    size_t slotIdx = hashCode(key, i);
+template <typename Key, typename Value, typename Hash, typename ProbingPolicy>
+size_t OpenAddressingHashTable<Key, Value, Hash, ProbingPolicy>::search(
+    const std::vector<uint8_t> &controls, const std::vector<Key> &slotKeys,
+    const std::vector<size_t> &codes, const Key &key, size_t hash,
+    size_t &availableSlot, size_t &collisions) const {
+  size_t size = controls.size();
+  uint8_t control = SlotControl::active(hash);
+
+  if constexpr (ProbingPolicy::GROUP_SCAN) {
+    constexpr size_t groupSize = ProbingPolicy::GROUP_SIZE;
+    uint8_t wrapped[groupSize];
+
+    for (size_t scanned = 0; scanned < size; scanned += groupSize) {
+      size_t start = probe(hash, scanned, size);
+      size_t end = probe(hash, scanned + groupSize - 1, size);
+      const uint8_t *group = &controls[start];
+
+      // A group running past the end of the table goes on at its start.
+      if (start + groupSize > size) {
+        for (size_t j = 0; j < groupSize; j++)
+          wrapped[j] = controls[probe(start, j, size)];
+        group = wrapped;
+      }
 
-    const Slot<Key, Value> &slot = this->table[slotIdx];
+      auto masks = ProbingPolicy::scanGroup(group, control);
 
-    if (slot.status == EMPTY) {
       this->incrementCounter(1);
-      break;
+      probesCount++;
+      cacheLinesCount += start / CACHE_LINE_SIZE == end / CACHE_LINE_SIZE ? 1
+                                                                           : 2;
+
+      // The probe sequence ends at the first empty slot of the group.
+      uint32_t firstEmpty = masks.empties & (~masks.empties + 1);
+      uint32_t before = firstEmpty ? firstEmpty - 1 : ~0u;
+
+      for (uint32_t bits = masks.matches & before; bits; bits &= bits - 1) {
+        size_t index = probe(start, __builtin_ctz(bits), size);
+
+        if (holdsKey(slotKeys, codes, index, key, hash))
+          return index;
+      }
+
+      uint32_t occupied = ~masks.available & before & ((1u << groupSize) - 1);
+      collisions += __builtin_popcount(occupied);
+
+      uint32_t free = masks.available & (before | firstEmpty);
+      if (availableSlot == NOT_FOUND and free)
+        availableSlot = probe(start, __builtin_ctz(free), size);
+
+      if (firstEmpty)
+        break;
     }
+  } else {
+    size_t lastLine = NOT_FOUND;
 
-    if (slot.status == ACTIVE and slot.key == key)
-      tableSlot = &slot;
+    for (size_t i = 0; i < size; i++) {
+      size_t slotIdx = probe(hash, i, size);
+      uint8_t slot = controls[slotIdx];
 
-    this->incrementCounter(2);
+      this->incrementCounter(1);
+      probesCount++;
+
+      if (slotIdx / CACHE_LINE_SIZE != lastLine) {
+        lastLine = slotIdx / CACHE_LINE_SIZE;
+        cacheLinesCount++;
+      }
+
+      if (slot == SlotControl::EMPTY) {
+        if (availableSlot == NOT_FOUND)
+          availableSlot = slotIdx;
+        break;
+      }
+
+      if (slot == control and holdsKey(slotKeys, codes, slotIdx, key, hash))
+        return slotIdx;
+
+      if (slot != SlotControl::DELETED)
+        collisions++;
+      else if (availableSlot == NOT_FOUND)
+        availableSlot = slotIdx;
+    }
   }
 
-  return ConstFindResult(tableSlot);
+  return NOT_FOUND;
 }
 
-template <typename Key, typename Value, typename Hash>
-typename OpenAddressingHashTable<Key, Value, Hash>::FindResult
-OpenAddressingHashTable<Key, Value, Hash>::findSlot(const Key &key) {
-  Slot<Key, Value> *tableSlot = nullptr, *availableSlot = nullptr;
+template <typename Key, typename Value, typename Hash, typename ProbingPolicy>
+typename OpenAddressingHashTable<Key, Value, Hash, ProbingPolicy>::FindResult
+OpenAddressingHashTable<Key, Value, Hash, ProbingPolicy>::findSlot(
+    const Key &key, size_t hash) const {
+  FindResult result{NOT_FOUND, NOT_FOUND, false, 0};
+
+  lookupsCount++;
+  result.slot = search(this->table, keys, hashes, key, hash,
+                       result.availableSlot, result.collisions);
+
+  // Keys not migrated yet are still in the old table.
+  if (!result.wasElementFound() and this->isRehashing()) {
+    size_t oldAvailableSlot = NOT_FOUND, oldCollisions = 0;
+    size_t oldIdx = search(this->oldTable, oldKeys, oldHashes, key, hash,
+                           oldAvailableSlot, oldCollisions);
+
+    if (oldIdx != NOT_FOUND) {
+      result.slot = oldIdx;
+      result.inOldTable = true;
+    }
+  }
 
-  for (size_t i = 0; i < this->tableSize; i++) {
-    size_t slotIdx = hashCode(key, i);
-    Slot<Key, Value> &slot = this->table[slotIdx];
+  return result;
+}
 
-    if (slot.status == EMPTY) {
-      if (!availableSlot)
-        availableSlot = &slot;
+template <typename Key, typename Value, typename Hash, typename ProbingPolicy>
+void OpenAddressingHashTable<Key, Value, Hash, ProbingPolicy>::place(
+    size_t index, const Key &key, const Value &value, size_t hash) {
+  if (this->table[index] == SlotControl::DELETED)
+    deletedCount--;
 
-      this->incrementCounter(2);
+  this->table[index] = SlotControl::active(hash);
+  keys[index] = key;
+  values[index] = value;
+  hashes[index] = hash;
+  this->numberOfElements++;
+}
 
-      break;
+template <typename Key, typename Value, typename Hash, typename ProbingPolicy>
+size_t OpenAddressingHashTable<Key, Value, Hash, ProbingPolicy>::migrate(
+    size_t index) {
+  size_t moved = 0;
+
+  if (SlotControl::isActive(this->oldTable[index])) {
+    size_t hash = oldHashes[index];
+
+    // The key is not in the current table yet, so it takes the first free
+    // slot of its probe sequence.
+    for (size_t i = 0; i < this->tableSize; i++) {
+      size_t slotIdx = probe(hash, i, this->tableSize);
+      uint8_t &slot = this->table[slotIdx];
+
+      if (!SlotControl::isActive(slot)) {
+        if (slot == SlotControl::DELETED)
+          deletedCount--;
+
+        slot = this->oldTable[index];
+        keys[slotIdx] = std::move(oldKeys[index]);
+        values[slotIdx] = std::move(oldValues[index]);
+        hashes[slotIdx] = hash;
+        break;
+      }
     }
 
-    if (slot.status == ACTIVE and slot.key == key) {
-      this->incrementCounter(2);
+    this->oldTable[index] = SlotControl::DELETED;
+    moved = 1;
+  }
+
+  if (index + 1 == this->oldTable.size()) {
+    std::vector<Key>().swap(oldKeys);
+    std::vector<Value>().swap(oldValues);
+    std::vector<size_t>().swap(oldHashes);
+  }
 
-      tableSlot = &slot;
-      break;
-    }
+  return moved;
+}
 
-    if (slot.status == DELETED and !availableSlot)
-      availableSlot = &slot;
+template <typename Key, typename Value, typename Hash, typename ProbingPolicy>
+void OpenAddressingHashTable<Key, Value, Hash, ProbingPolicy>::startRehash(
+    size_t size) {
+  this->beginRehash(size);
+
+  oldKeys.swap(keys);
+  oldValues.swap(values);
+  oldHashes.swap(hashes);
+  keys = std::vector<Key>(size);
+  values = std::vector<Value>(size);
+  hashes = std::vector<size_t>(size);
+  deletedCount = 0;
+}
 
-    this->incrementCounter(3);
+template <typename Key, typename Value, typename Hash, typename ProbingPolicy>
+void OpenAddressingHashTable<Key, Value, Hash, ProbingPolicy>::compact() {
+  for (uint8_t &slot : this->table)
+    slot = SlotControl::isActive(slot) ? SlotControl::DELETED
+                                       : SlotControl::EMPTY;
+
+  for (size_t index = 0; index < this->tableSize; index++) {
+    while (this->table[index] == SlotControl::DELETED) {
+      size_t hash = hashes[index];
+
+      for (size_t i = 0; i < this->tableSize; i++) {
+        size_t targetIdx = probe(hash, i, this->tableSize);
+        uint8_t &target = this->table[targetIdx];
+
+        if (targetIdx == index) {
+          target = SlotControl::active(hash);
+          break;
+        }
+
+        if (target == SlotControl::EMPTY) {
+          target = SlotControl::active(hash);
+          keys[targetIdx] = std::move(keys[index]);
+          values[targetIdx] = std::move(values[index]);
+          hashes[targetIdx] = hash;
+          this->table[index] = SlotControl::EMPTY;
+          break;
+        }
+
+        if (target == SlotControl::DELETED) {
+          target = SlotControl::active(hash);
+          std::swap(keys[index], keys[targetIdx]);
+          std::swap(values[index], values[targetIdx]);
+          std::swap(hashes[index], hashes[targetIdx]);
+          break;
+        }
+      }
+    }
   }
 
-  return FindResult(tableSlot, availableSlot);
+  deletedCount = 0;
+  compactionsCount++;
 }
 
-template <typename Key, typename Value, typename Hash>
-size_t OpenAddressingHashTable<Key, Value, Hash>::nextBase2Of(size_t m) const {
+template <typename Key, typename Value, typename Hash, typename ProbingPolicy>
+size_t OpenAddressingHashTable<Key, Value, Hash, ProbingPolicy>::nextBase2Of(
+    size_t m) const {
   if (m <= 0)
     return 1;
 
@@ -95,194 +267,320 @@ size_t OpenAddressingHashTable<Key, Value, Hash>::nextBase2Of(size_t m) const {
   return (n + 1);
 }
 
-template <typename Key, typename Value, typename Hash>
-OpenAddressingHashTable<Key, Value, Hash>::OpenAddressingHashTable(size_t size,
-                                                                   float mlf)
-    : BaseHashTable<OpenAddressingHashTable<Key, Value, Hash>, Slot<Key, Value>,
-                    Key, Value, Hash>(nextBase2Of(size), mlf) {}
-
-template <typename Key, typename Value, typename Hash>
-void OpenAddressingHashTable<Key, Value, Hash>::rehash(size_t m) {
-
-  if (m > this->tableSize) {
-    std::vector<Slot<Key, Value>> copy = this->table;
-    this->table.clear();
-    this->table.resize(m);
-    this->tableSize = m;
-    this->numberOfElements = 0;
-
-    for (auto &slot : copy) {
-      if (slot.status == ACTIVE)
-        insert(slot.key, slot.value);
-    }
-  }
+template <typename Key, typename Value, typename Hash, typename ProbingPolicy>
+OpenAddressingHashTable<Key, Value, Hash,
+                        ProbingPolicy>::OpenAddressingHashTable(size_t size,
+                                                                float mlf)
+    : BaseHashTable<OpenAddressingHashTable<Key, Value, Hash, ProbingPolicy>,
+                    uint8_t, Key, Value, Hash>(nextBase2Of(size), mlf),
+      deletedCount(0), compactionsCount(0), lookupsCount(0), probesCount(0),
+      cacheLinesCount(0), keys(this->tableSize), values(this->tableSize),
+      hashes(this->tableSize) {}
+
+template <typename Key, typename Value, typename Hash, typename ProbingPolicy>
+void OpenAddressingHashTable<Key, Value, Hash, ProbingPolicy>::rehash(
+    size_t m) {
+  if (m > this->tableSize)
+    startRehash(m);
 }
 
-template <typename Key, typename Value, typename Hash>
-void OpenAddressingHashTable<Key, Value, Hash>::insert(const Key &key,
-                                                       const Value &value) {
+template <typename Key, typename Value, typename Hash, typename ProbingPolicy>
+void OpenAddressingHashTable<Key, Value, Hash, ProbingPolicy>::insert(
+    const Key &key, const Value &value) {
   this->checkAndRehash();
 
-  int lastDeletedSlot = -1;
+  size_t hash = this->hashing(key);
+  FindResult response = findSlot(key, hash);
 
-  for (size_t i = 0; i < this->tableSize; i++) {
-    size_t slotIdx = hashCode(key, i);
-    Slot<Key, Value> &slot = this->table[slotIdx];
+  this->incrementCollisionsCount(response.collisions);
 
-    if (slot.status == EMPTY) {
-      if (lastDeletedSlot == -1) {
-        this->incrementCounter(1);
-        slot = Slot(key, value);
-        this->numberOfElements++;
-        return;
-      }
-
-      break;
-    } else if (slot.status == ACTIVE and slot.key == key) {
-      this->incrementCounter(2);
-      throw KeyAlreadyExistsException();
-    } else if (slot.status == ACTIVE and slot.key != key) {
-      this->incrementCollisionsCount();
-      this->incrementCounter(3);
-    } else if (slot.status == DELETED and lastDeletedSlot == -1) {
-      this->incrementCounter(4);
-      lastDeletedSlot = slotIdx;
-    } else {
-      this->incrementCounter(4);
-    }
-  }
+  if (response.wasElementFound())
+    throw KeyAlreadyExistsException();
 
-  this->table[lastDeletedSlot] = Slot(key, value);
+  place(response.availableSlot, key, value, hash);
 }
 
-template <typename Key, typename Value, typename Hash>
-bool OpenAddressingHashTable<Key, Value, Hash>::find(const Key &key,
-                                                     Value &outValue) const {
-  ConstFindResult response = findConstSlot(key);
+template <typename Key, typename Value, typename Hash, typename ProbingPolicy>
+bool OpenAddressingHashTable<Key, Value, Hash, ProbingPolicy>::find(
+    const Key &key, Value &outValue) const {
+  FindResult response = findSlot(key, this->hashing(key));
   bool wasElementFound = response.wasElementFound();
 
   if (wasElementFound)
-    outValue = response.slot->value;
+    outValue = response.inOldTable ? oldValues[response.slot]
+                                   : values[response.slot];
 
   return wasElementFound;
 }
 
-template <typename Key, typename Value, typename Hash>
-void OpenAddressingHashTable<Key, Value, Hash>::update(const Key &key,
-                                                       const Value &value) {
-  FindResult response = findSlot(key);
-  bool wasElementFound = response.wasElementFound();
+template <typename Key, typename Value, typename Hash, typename ProbingPolicy>
+void OpenAddressingHashTable<Key, Value, Hash, ProbingPolicy>::update(
+    const Key &key, const Value &value) {
+  FindResult response = findSlot(key, this->hashing(key));
 
-  if (!wasElementFound)
+  if (!response.wasElementFound())
     throw KeyNotFoundException();
 
-  response.slot->value = value;
+  (response.inOldTable ? oldValues : values)[response.slot] = value;
 }
 
-template <typename Key, typename Value, typename Hash>
-void OpenAddressingHashTable<Key, Value, Hash>::remove(const Key &key) {
-  FindResult response = findSlot(key);
+template <typename Key, typename Value, typename Hash, typename ProbingPolicy>
+void OpenAddressingHashTable<Key, Value, Hash, ProbingPolicy>::remove(
+    const Key &key) {
+  FindResult response = findSlot(key, this->hashing(key));
 
-  if (response.wasElementFound())
-    response.slot->status = DELETED;
+  if (!response.wasElementFound())
+    return;
+
+  this->numberOfElements--;
+
+  if (response.inOldTable) {
+    this->oldTable[response.slot] = SlotControl::DELETED;
+    return;
+  }
+
+  this->table[response.slot] = SlotControl::DELETED;
+  deletedCount++;
+
+  if (deletedCount > MAX_DELETED_RATIO * this->tableSize and
+      !this->isRehashing())
+    compact();
 }
 
-template <typename Key, typename Value, typename Hash>
-void OpenAddressingHashTable<Key, Value, Hash>::clear() {
+template <typename Key, typename Value, typename Hash, typename ProbingPolicy>
+void OpenAddressingHashTable<Key, Value, Hash, ProbingPolicy>::shrinkToFit() {
+  this->completeRehash();
+
+  size_t size = 1;
+  while (this->numberOfElements >= this->maxLoadFactor * size)
+    size *= 2;
+
+  if (size < this->tableSize) {
+    startRehash(size);
+    this->completeRehash();
+  } else if (deletedCount > 0) {
+    compact();
+  }
+}
+
+template <typename Key, typename Value, typename Hash, typename ProbingPolicy>
+void OpenAddressingHashTable<Key, Value, Hash, ProbingPolicy>::clear() {
   this->clearHashTable();
+
+  std::vector<Key>(this->tableSize).swap(keys);
+  std::vector<Value>(this->tableSize).swap(values);
+  std::vector<size_t>(this->tableSize).swap(hashes);
+  std::vector<Key>().swap(oldKeys);
+  std::vector<Value>().swap(oldValues);
+  std::vector<size_t>().swap(oldHashes);
+  deletedCount = 0;
+  compactionsCount = 0;
+  lookupsCount = 0;
+  probesCount = 0;
+  cacheLinesCount = 0;
 }
 
-template <typename Key, typename Value, typename Hash>
-void OpenAddressingHashTable<Key, Value, Hash>::printInOrder(
+template <typename Key, typename Value, typename Hash, typename ProbingPolicy>
+void OpenAddressingHashTable<Key, Value, Hash, ProbingPolicy>::printInOrder(
     std::ostream &out) const {
   size_t maxKeyLen = 0, maxValLen = 0, i = 0;
-  std::vector<Slot<Key, Value>> vec(this->numberOfElements);
+  std::vector<std::pair<Key, Value>> vec(this->numberOfElements);
 
-  for (const Slot<Key, Value> &slot : this->table) {
-    if (slot.status == ACTIVE) {
-      maxKeyLen = std::max(maxKeyLen, StringHandler::size(slot.key));
-      maxValLen = std::max(maxValLen, StringHandler::size(slot.value));
+  forEach([&](const Key &key, const Value &value) {
+    maxKeyLen = std::max(maxKeyLen, StringHandler::size(key));
+    maxValLen = std::max(maxValLen, StringHandler::size(value));
 
-      vec[i++] = slot;
-    }
-  }
+    vec[i++] = {key, value};
+  });
 
   std::sort(vec.begin(), vec.end(),
-            [](const Slot<Key, Value> &slotA, const Slot<Key, Value> &slotB) {
-              return slotA.key < slotB.key;
-            });
+            [](const auto &pa, const auto &pb) { return pa.first < pb.first; });
+
+  for (const auto &p : vec)
+    out << StringHandler::SetWidthAtLeft(p.first, maxKeyLen) << " | "
+        << StringHandler::SetWidthAtLeft(p.second, maxValLen) << "\n";
+}
+
+template <typename Key, typename Value, typename Hash, typename ProbingPolicy>
+void OpenAddressingHashTable<Key, Value, Hash, ProbingPolicy>::forEach(
+    const std::function<void(const Key &, const Value &)> &action) const {
+  for (size_t i = 0; i < this->table.size(); i++)
+    if (SlotControl::isActive(this->table[i]))
+      action(keys[i], values[i]);
 
-  for (const Slot<Key, Value> &slot : vec)
-    if (slot.status == ACTIVE)
-      out << StringHandler::SetWidthAtLeft(slot.key, maxKeyLen) << " | "
-          << StringHandler::SetWidthAtLeft(slot.value, maxValLen) << "\n";
+  for (size_t i = 0; i < this->oldTable.size(); i++)
+    if (SlotControl::isActive(this->oldTable[i]))
+      action(oldKeys[i], oldValues[i]);
 }
 
-template <typename Key, typename Value, typename Hash>
-size_t OpenAddressingHashTable<Key, Value, Hash>::getComparisonsCount() const {
+template <typename Key, typename Value, typename Hash, typename ProbingPolicy>
+size_t OpenAddressingHashTable<Key, Value, Hash,
+                               ProbingPolicy>::getComparisonsCount() const {
   return this->comparisonsCount;
 }
 
-template <typename Key, typename Value, typename Hash>
-Value &OpenAddressingHashTable<Key, Value, Hash>::operator[](const Key &key) {
+template <typename Key, typename Value, typename Hash, typename ProbingPolicy>
+Value &OpenAddressingHashTable<Key, Value, Hash, ProbingPolicy>::operator[](
+    const Key &key) {
   this->checkAndRehash();
 
-  FindResult response = findSlot(key);
+  size_t hash = this->hashing(key);
+  FindResult response = findSlot(key, hash);
 
   if (response.wasElementFound())
-    return response.slot->value;
+    return (response.inOldTable ? oldValues : values)[response.slot];
 
-  this->numberOfElements++;
-  response.availableSlot->key = key;
-  response.availableSlot->value = Value();
-  response.availableSlot->status = ACTIVE;
-  return response.availableSlot->value;
+  this->incrementCollisionsCount(response.collisions);
+
+  place(response.availableSlot, key, Value(), hash);
+  return values[response.availableSlot];
 }
 
-template <typename Key, typename Value, typename Hash>
+template <typename Key, typename Value, typename Hash, typename ProbingPolicy>
 const Value &
-OpenAddressingHashTable<Key, Value, Hash>::operator[](const Key &key) const {
-  ConstFindResult response = findConstSlot(key);
+OpenAddressingHashTable<Key, Value, Hash, ProbingPolicy>::operator[](
+    const Key &key) const {
+  FindResult response = findSlot(key, this->hashing(key));
 
   if (!response.wasElementFound())
     throw KeyNotFoundException();
 
-  return response.slot->value;
+  return (response.inOldTable ? oldValues : values)[response.slot];
 }
 
-template <typename Key, typename Value, typename Hash>
-size_t OpenAddressingHashTable<Key, Value, Hash>::getCollisionsCount() const {
+template <typename Key, typename Value, typename Hash, typename ProbingPolicy>
+size_t OpenAddressingHashTable<Key, Value, Hash,
+                               ProbingPolicy>::getCollisionsCount() const {
   return this->collisionsCount;
 }
 
-template <typename Key, typename Value, typename Hash>
-size_t OpenAddressingHashTable<Key, Value, Hash>::getTableSize() const {
+template <typename Key, typename Value, typename Hash, typename ProbingPolicy>
+void OpenAddressingHashTable<Key, Value, Hash, ProbingPolicy>::mergeFrom(
+    const IDictionary<Key, Value> &other) {
+  if (&other == this) {
+    this->completeRehash();
+
+    for (size_t i = 0; i < this->table.size(); i++)
+      if (SlotControl::isActive(this->table[i]))
+        values[i] += values[i];
+    return;
+  }
+
+  size_t incoming = 0;
+  other.forEach([&incoming](const Key &, const Value &) { incoming++; });
+
+  // The rehash started by reserve() is finished before the merge, so that
+  // the increments do not migrate slots as they go.
+  reserve(this->numberOfElements + incoming);
+  this->completeRehash();
+
+  IDictionary<Key, Value>::mergeFrom(other);
+}
+
+template <typename Key, typename Value, typename Hash, typename ProbingPolicy>
+void OpenAddressingHashTable<Key, Value, Hash, ProbingPolicy>::reserve(
+    size_t n) {
+  // Table sizes stay powers of two, so that the probe sequence visits every
+  // slot.
+  size_t size = this->tableSize;
+  while (n >= this->maxLoadFactor * size)
+    size *= 2;
+
+  rehash(size);
+}
+
+template <typename Key, typename Value, typename Hash, typename ProbingPolicy>
+size_t
+OpenAddressingHashTable<Key, Value, Hash, ProbingPolicy>::getTableSize() const {
   return this->tableSize;
 }
 
-template <typename Key, typename Value, typename Hash>
-void OpenAddressingHashTable<Key, Value, Hash>::print() const {
+template <typename Key, typename Value, typename Hash, typename ProbingPolicy>
+size_t OpenAddressingHashTable<Key, Value, Hash,
+                               ProbingPolicy>::getDeletedCount() const {
+  return deletedCount;
+}
+
+template <typename Key, typename Value, typename Hash, typename ProbingPolicy>
+size_t OpenAddressingHashTable<Key, Value, Hash,
+                               ProbingPolicy>::getCompactionsCount() const {
+  return compactionsCount;
+}
+
+template <typename Key, typename Value, typename Hash, typename ProbingPolicy>
+size_t OpenAddressingHashTable<Key, Value, Hash,
+                               ProbingPolicy>::getLookupsCount() const {
+  return lookupsCount;
+}
+
+template <typename Key, typename Value, typename Hash, typename ProbingPolicy>
+size_t OpenAddressingHashTable<Key, Value, Hash,
+                               ProbingPolicy>::getProbesCount() const {
+  return probesCount;
+}
+
+template <typename Key, typename Value, typename Hash, typename ProbingPolicy>
+size_t OpenAddressingHashTable<Key, Value, Hash,
+                               ProbingPolicy>::getCacheLinesCount() const {
+  return cacheLinesCount;
+}
+
+template <typename Key, typename Value, typename Hash, typename ProbingPolicy>
+std::vector<size_t> OpenAddressingHashTable<Key, Value, Hash, ProbingPolicy>::
+    getProbeLengthHistogram() const {
+  std::vector<size_t> histogram;
+
+  auto addTable = [&](const std::vector<uint8_t> &controls,
+                      const std::vector<size_t> &codes) {
+    for (size_t slot = 0; slot < controls.size(); slot++) {
+      if (!SlotControl::isActive(controls[slot]))
+        continue;
+
+      size_t i = 0;
+      while (probe(codes[slot], i, controls.size()) != slot)
+        i++;
+
+      if (i >= histogram.size())
+        histogram.resize(i + 1, 0);
+      histogram[i]++;
+    }
+  };
+
+  addTable(this->table, hashes);
+  addTable(this->oldTable, oldHashes);
+
+  return histogram;
+}
+
+template <typename Key, typename Value, typename Hash, typename ProbingPolicy>
+void OpenAddressingHashTable<Key, Value, Hash, ProbingPolicy>::print() const {
   for (size_t i = 0; i < this->table.size(); ++i) {
-    const auto &slot = this->table[i];
+    uint8_t slot = this->table[i];
     std::cout << "Slot " << i << ": ";
-    if (slot.status == EMPTY) {
+    if (slot == SlotControl::EMPTY) {
       std::cout << "EMPTY";
-    } else if (slot.status == DELETED) {
+    } else if (slot == SlotControl::DELETED) {
       std::cout << "DELETED";
-    } else if (slot.status == ACTIVE) {
-      std::cout << "ACTIVE [" << slot.key << ": " << slot.value << "]";
+    } else {
+      std::cout << "ACTIVE [" << keys[i] << ": " << values[i] << "]";
     }
     std::cout << '\n';
   }
 }
 
-template <typename Key, typename Value, typename Hash>
-void OpenAddressingHashTable<Key, Value, Hash>::accept(
+template <typename Key, typename Value, typename Hash, typename ProbingPolicy>
+void OpenAddressingHashTable<Key, Value, Hash, ProbingPolicy>::accept(
     IDictionaryVisitor<Key, Value> &visitor) const {
   visitor.collectMetrics(*this);
 }
 
-template <typename Key, typename Value, typename Hash>
-size_t OpenAddressingHashTable<Key, Value, Hash>::getMemoryUsage() const {
-  return this->sizeOf();
+template <typename Key, typename Value, typename Hash, typename ProbingPolicy>
+size_t OpenAddressingHashTable<Key, Value, Hash,
+                               ProbingPolicy>::getMemoryUsage() const {
+  return sizeof(*this) +
+         (this->table.capacity() + this->oldTable.capacity()) *
+             sizeof(uint8_t) +
+         (keys.capacity() + oldKeys.capacity()) * sizeof(Key) +
+         (values.capacity() + oldValues.capacity()) * sizeof(Value) +
+         (hashes.capacity() + oldHashes.capacity()) * sizeof(size_t);
 }
\ No newline at end of file
@@ -0,0 +1,158 @@
+#ifndef PROBING_POLICIES_HPP
+#define PROBING_POLICIES_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include "HashTables/OpenAddressing/Slot.hpp"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/**
+ * @file ProbingPolicies.hpp
+ * @brief Policies that choose the probe sequence of an open addressing hash
+ * table.
+ *
+ * A policy provides:
+ * - `static size_t probe(size_t hash, size_t i, size_t size)`: the slot of
+ *   the i-th probe of a hash code in a table of `size` slots, a power of two.
+ *   The first `size` probes must visit every slot.
+ * - `static constexpr bool GROUP_SCAN`: whether lookups read the control
+ *   bytes a group at a time with scanGroup(), in the order of `probe`,
+ *   instead of one by one.
+ *
+ * The policy is a template parameter of OpenAddressingHashTable, so `probe`
+ * is inlined into every lookup.
+ */
+
+/**
+ * @class LinearProbing
+ * @brief Probes the slots one after another.
+ *
+ * Consecutive probes share cache lines, but the keys of neighbouring home
+ * slots run into each other's sequences and form long clusters as the table
+ * fills up.
+ */
+class LinearProbing {
+public:
+  static constexpr bool GROUP_SCAN = false;
+
+  static size_t probe(size_t hash, size_t i, size_t size) {
+    return (hash + i) & (size - 1);
+  }
+};
+
+/**
+ * @class QuadraticProbing
+ * @brief Probes at the triangular offsets i(i + 1)/2 from the home slot.
+ *
+ * This is the original behavior of the table. The first probes stay close
+ * to the home slot, and the growing steps break the clusters of linear
+ * probing.
+ */
+class QuadraticProbing {
+public:
+  static constexpr bool GROUP_SCAN = false;
+
+  static size_t probe(size_t hash, size_t i, size_t size) {
+    return (hash + ((i + (i * i)) / 2)) & (size - 1);
+  }
+};
+
+/**
+ * @class DoubleHashing
+ * @brief Probes at multiples of a step taken from the hash code.
+ *
+ * The step is the top 32 bits of the code times 2^64 over the golden ratio,
+ * made odd so that it visits every slot of a power-of-two table. Keys with
+ * the same home slot follow different sequences, which avoids clustering,
+ * but every probe after the first lands on a different cache line.
+ */
+class DoubleHashing {
+public:
+  static constexpr bool GROUP_SCAN = false;
+
+  static size_t probe(size_t hash, size_t i, size_t size) {
+    uint64_t mixed = static_cast<uint64_t>(hash) * 11400714819323198485ULL;
+    size_t step = static_cast<size_t>(mixed >> 32) | 1;
+    return (hash + i * step) & (size - 1);
+  }
+};
+
+/**
+ * @class GroupScanProbing
+ * @brief Probes the slots one after another, like LinearProbing, but looks
+ * up GROUP_SIZE control bytes at once.
+ *
+ * scanGroup() compares a group of control bytes with a fingerprint and with
+ * EMPTY in a couple of SSE2 instructions, returning bit masks, so a lookup
+ * takes one step per group and visits only the slots whose fingerprint
+ * matches. Without SSE2 the masks are built byte by byte.
+ */
+class GroupScanProbing {
+public:
+  static constexpr bool GROUP_SCAN = true;
+
+  /**
+   * @brief The number of control bytes looked up at once.
+   */
+  static constexpr size_t GROUP_SIZE = 16;
+
+  /**
+   * @brief Bit masks of the slots of a group, bit j for the j-th slot.
+   */
+  struct GroupMasks {
+    /**
+     * @brief The slots whose control byte is the fingerprint searched for.
+     */
+    uint32_t matches;
+
+    /**
+     * @brief The empty slots.
+     */
+    uint32_t empties;
+
+    /**
+     * @brief The slots holding no key: empty or deleted.
+     */
+    uint32_t available;
+  };
+
+  static size_t probe(size_t hash, size_t i, size_t size) {
+    return (hash + i) & (size - 1);
+  }
+
+  /**
+   * @brief Compares GROUP_SIZE control bytes with `control` and with EMPTY.
+   *
+   * @param group The first control byte of the group.
+   * @param control The control byte of the key searched for.
+   */
+  static GroupMasks scanGroup(const uint8_t *group, uint8_t control) {
+#if defined(__SSE2__)
+    __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(group));
+    auto mask = [&bytes](uint8_t value) {
+      return static_cast<uint32_t>(_mm_movemask_epi8(
+          _mm_cmpeq_epi8(bytes, _mm_set1_epi8(static_cast<char>(value)))));
+    };
+
+    // The ACTIVE bit is the sign bit of each byte.
+    uint32_t active = static_cast<uint32_t>(_mm_movemask_epi8(bytes));
+    return {mask(control), mask(SlotControl::EMPTY), ~active & 0xFFFF};
+#else
+    GroupMasks masks{0, 0, 0};
+    for (size_t j = 0; j < GROUP_SIZE; j++) {
+      masks.matches |= static_cast<uint32_t>(group[j] == control) << j;
+      masks.empties |= static_cast<uint32_t>(group[j] == SlotControl::EMPTY)
+                       << j;
+      masks.available |=
+          static_cast<uint32_t>(!SlotControl::isActive(group[j])) << j;
+    }
+    return masks;
+#endif
+  }
+};
+
+#endif
@@ -1,64 +1,55 @@
 #ifndef SLOT_HPP
 #define SLOT_HPP
 
-enum Status { EMPTY, ACTIVE, DELETED };
+#include <cstddef>
+#include <cstdint>
 
-template <typename Key, typename Value>
 /**
- * @struct Slot
- * @brief Represents a slot in an open addressing hash table.
+ * @struct SlotControl
+ * @brief The control byte kept for each slot of an open addressing hash
+ * table, apart from its key and value.
  *
- * The Slot structure is used to store a key-value pair along with its status
- * in an open addressing hash table. The status indicates whether the slot
- * is empty, active, or deleted.
- *
- * @var Slot::key
- * The key associated with the slot.
- *
- * @var Slot::value
- * The value associated with the slot.
- *
- * @var Slot::status
- * The status of the slot, which can be EMPTY, ACTIVE, or DELETED.
- *
- * @fn Slot::Slot()
- * Default constructor that initializes the slot with an EMPTY status.
- *
- * @fn Slot::Slot(const Key& k, const Value& v)
- * Parameterized constructor that initializes the slot with a given key and
- * value, and sets the status to ACTIVE.
- *
- * @note The `Key` and `Value` types, as well as the `Status` enumeration, are
- * assumed to be defined elsewhere in the codebase.
+ * A control byte is EMPTY, DELETED, or, for a slot holding a key, has the
+ * ACTIVE bit set and a 7-bit fingerprint of the key's hash code in the other
+ * bits. A probe reads only control bytes, packed 64 to a cache line, and
+ * compares a key only when its fingerprint matches the one searched for,
+ * which happens for one in 128 other keys.
  */
-struct Slot {
+struct SlotControl {
   /**
-   * @brief The key associated with this slot.
+   * @brief The control byte of a slot that never held a key since the table
+   * was allocated or compacted. Probes stop at it.
    */
-  Key key;
+  static constexpr uint8_t EMPTY = 0;
 
   /**
-   * @brief The value associated with the key.
+   * @brief The control byte of a slot whose key was removed (a tombstone).
+   * Probes run through it.
    */
-  Value value;
+  static constexpr uint8_t DELETED = 1;
 
   /**
-   * @brief The current status of the slot (e.g., EMPTY, ACTIVE, DELETED).
+   * @brief The bit set in the control byte of every slot holding a key.
    */
-  Status status;
+  static constexpr uint8_t ACTIVE = 0x80;
 
   /**
-   * @brief Default constructor. Initializes the slot as EMPTY.
+   * @brief Returns the control byte of a slot holding a key with the given
+   * hash code.
+   *
+   * The fingerprint is taken from the top bits of the code times 2^64 over
+   * the golden ratio, so that it depends on every bit of the code and not on
+   * the low bits that choose the slot.
    */
-  Slot() : status(EMPTY) {}
+  static uint8_t active(size_t hash) {
+    uint64_t mixed = static_cast<uint64_t>(hash) * 11400714819323198485ULL;
+    return ACTIVE | static_cast<uint8_t>(mixed >> 57);
+  }
 
   /**
-   * @brief Constructs a slot with a key and value. Sets status to ACTIVE.
-   *
-   * @param k The key to store.
-   * @param v The value associated with the key.
+   * @brief Tells whether a control byte belongs to a slot holding a key.
    */
-  Slot(const Key &k, const Value &v) : key(k), value(v), status(ACTIVE) {}
+  static bool isActive(uint8_t control) { return control & ACTIVE; }
 };
 
 #endif
\ No newline at end of file
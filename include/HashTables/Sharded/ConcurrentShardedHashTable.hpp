@@ -0,0 +1,266 @@
+#ifndef CONCURRENT_SHARDED_HASH_TABLE_HPP
+#define CONCURRENT_SHARDED_HASH_TABLE_HPP
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "Dictionary/IDictionary.hpp"
+
+/**
+ * @brief A hash table split into independently locked shards, so that several
+ * threads may use it at once.
+ *
+ * Each key belongs to one shard, chosen from the high bits of its mixed hash
+ * code so that the choice does not correlate with the slot the shard picks
+ * from the low bits. Every operation locks only the shard of its key, so
+ * threads working on different shards never wait for each other. Each shard
+ * and its lock sit on cache lines of their own, so locking one shard does
+ * not slow down threads working on its neighbours.
+ *
+ * Lock contention is measured per shard: every acquisition is counted, and
+ * the ones that find the lock taken also add the time spent waiting.
+ *
+ * @tparam Key The type of the keys.
+ * @tparam Value The type of the values.
+ * @tparam Shard The hash table of each shard: ChainedHashTable or
+ * OpenAddressingHashTable over the same Key, Value and Hash.
+ * @tparam Hash The hash function to be used (defaults to std::hash<Key>).
+ */
+template <typename Key, typename Value, typename Shard,
+          typename Hash = std::hash<Key>>
+class ConcurrentShardedHashTable : public IDictionary<Key, Value> {
+public:
+  /**
+   * @brief Lock usage aggregated over a set of shards.
+   */
+  struct LockStatistics {
+    /**
+     * @brief Times a shard lock was acquired.
+     */
+    size_t acquisitions;
+
+    /**
+     * @brief Acquisitions that found the lock held by another thread.
+     */
+    size_t contendedAcquisitions;
+
+    /**
+     * @brief Time spent waiting for locks held by other threads.
+     */
+    std::chrono::nanoseconds waitTime;
+  };
+
+  /**
+   * @brief Default number of shards.
+   */
+  static const size_t DEFAULT_SHARDS = 64;
+
+private:
+  /**
+   * @brief A shard with its lock and contention counters, aligned to a cache
+   * line to avoid false sharing between shards.
+   */
+  struct alignas(64) ShardSlot {
+    mutable std::mutex mutex;
+    Shard table;
+    mutable std::atomic<size_t> acquisitions{0};
+    mutable std::atomic<size_t> contendedAcquisitions{0};
+    mutable std::atomic<int64_t> waitNanoseconds{0};
+
+    /**
+     * @brief Constructs a shard whose table has `size` slots.
+     */
+    explicit ShardSlot(size_t size) : table(size) {}
+  };
+
+  /**
+   * @brief The shards. Held through pointers so that their alignment does
+   * not depend on the allocator of the vector.
+   */
+  std::vector<std::unique_ptr<ShardSlot>> shards;
+
+  /**
+   * @brief Hash function object used to choose the shard of a key.
+   */
+  Hash hashing;
+
+  /**
+   * @brief Returns the shard of a key.
+   */
+  ShardSlot &shardOf(const Key &key) const;
+
+  /**
+   * @brief Locks a shard, recording the acquisition and, if the lock was
+   * held, the time spent waiting for it.
+   */
+  static std::unique_lock<std::mutex> lock(const ShardSlot &shard);
+
+public:
+  /**
+   * @brief Constructs an empty table.
+   *
+   * @param shardsCount The number of shards.
+   * @param shardSize The initial number of slots of each shard's table.
+   * @throws std::invalid_argument If `shardsCount` is zero.
+   */
+  explicit ConcurrentShardedHashTable(size_t shardsCount = DEFAULT_SHARDS,
+                                      size_t shardSize = 8);
+
+  ConcurrentShardedHashTable(const ConcurrentShardedHashTable &) = delete;
+  ConcurrentShardedHashTable &
+  operator=(const ConcurrentShardedHashTable &) = delete;
+
+  /**
+   * @brief Inserts a key-value pair. Thread-safe.
+   *
+   * @param key The key to be inserted.
+   * @param value The value associated with the key.
+   * @throws KeyAlreadyExistsException If the key is already present.
+   */
+  void insert(const Key &key, const Value &value) override;
+
+  /**
+   * @brief Searches for a key and retrieves its value if found. Thread-safe.
+   *
+   * @param key The key to search for.
+   * @param outValue Receives the value of the key, if found.
+   * @return true if the key is found; false otherwise.
+   */
+  bool find(const Key &key, Value &outValue) const override;
+
+  /**
+   * @brief Replaces the value of an existing key. Thread-safe.
+   *
+   * @param key The key to be updated.
+   * @param value The new value.
+   * @throws KeyNotFoundException If the key is not present.
+   */
+  void update(const Key &key, const Value &value) override;
+
+  /**
+   * @brief Removes a key. Thread-safe.
+   *
+   * @param key The key to be removed.
+   */
+  void remove(const Key &key) override;
+
+  /**
+   * @brief Removes every key and resets the statistics. Thread-safe, but
+   * other threads may see the shards being emptied one at a time.
+   */
+  void clear() override;
+
+  /**
+   * @brief Makes room in every shard for its share of `n` keys. Thread-safe.
+   *
+   * @param n The number of keys to make room for.
+   */
+  void reserve(size_t n) override;
+
+  /**
+   * @brief Shrinks every shard to fit its keys. Thread-safe.
+   */
+  void shrinkToFit() override;
+
+  /**
+   * @brief Prints the key-value pairs of every shard, ordered by key.
+   *
+   * @param out The output stream.
+   */
+  void printInOrder(std::ostream &out) const override;
+
+  /**
+   * @brief Calls a function on every key-value pair, shard by shard, each
+   * shard locked while it is traversed.
+   *
+   * @param action The function called with each key and value.
+   */
+  void forEach(const std::function<void(const Key &, const Value &)> &action)
+      const override;
+
+  /**
+   * @brief Returns the key comparisons made by all shards.
+   */
+  size_t getComparisonsCount() const override;
+
+  /**
+   * @brief Returns a reference to the value of a key, inserting a
+   * default-constructed value if the key is not present.
+   *
+   * The lookup runs under the lock of the shard, but the reference points
+   * into the shard's storage after the lock is released, and an insertion
+   * into the same shard may rehash or migrate that storage. The reference is
+   * therefore valid only while no other thread writes to the dictionary; use
+   * increment() to count concurrently.
+   *
+   * @param key The key to access.
+   * @return Value& A reference to the value.
+   */
+  Value &operator[](const Key &key) override;
+
+  /**
+   * @brief Returns a const reference to the value of a key.
+   *
+   * Not thread-safe: as with the non-const version, the reference is valid
+   * only while no other thread writes to the dictionary. Use find() to read
+   * while other threads are counting.
+   *
+   * @param key The key to access.
+   * @return const Value& A reference to the value.
+   * @throws KeyNotFoundException If the key is not present.
+   */
+  const Value &operator[](const Key &key) const override;
+
+  /**
+   * @brief Adds an amount to the value of a key, inserting the key first if
+   * needed, under the lock of its shard.
+   *
+   * @param key The key whose value is incremented.
+   * @param amount The amount to add.
+   */
+  void increment(const Key &key, const Value &amount) override;
+
+  /**
+   * @brief Always true: every operation locks the shard it works on. The
+   * references returned by operator[] are not protected once it returns.
+   */
+  bool isThreadSafe() const override;
+
+  /**
+   * @brief Returns the number of shards.
+   */
+  size_t getShardsCount() const;
+
+  /**
+   * @brief Returns the table of a shard. Must not be called while other
+   * threads use the table.
+   *
+   * @param index The index of the shard, in [0, getShardsCount()).
+   */
+  const Shard &getShard(size_t index) const;
+
+  /**
+   * @brief Returns the lock usage of every shard, added together.
+   */
+  LockStatistics getLockStatistics() const;
+
+  /**
+   * @brief Accepts a visitor implementing IDictionaryVisitor interface to
+   * collect metrics or perform operations on the ConcurrentShardedHashTable.
+   *
+   * @param visitor A reference to an IDictionaryVisitor<Key, Value> object that
+   * will interact with the ConcurrentShardedHashTable.
+   */
+  void accept(IDictionaryVisitor<Key, Value> &visitor) const override;
+
+  size_t getMemoryUsage() const override;
+};
+
+#include "HashTables/Sharded/ConcurrentShardedHashTable.impl.hpp"
+
+#endif
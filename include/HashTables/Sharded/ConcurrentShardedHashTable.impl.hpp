@@ -0,0 +1,236 @@
+#include "HashTables/Sharded/ConcurrentShardedHashTable.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+#include "Utils/Strings/StringHandler.hpp"
+
+template <typename Key, typename Value, typename Shard, typename Hash>
+typename ConcurrentShardedHashTable<Key, Value, Shard, Hash>::ShardSlot &
+ConcurrentShardedHashTable<Key, Value, Shard, Hash>::shardOf(
+    const Key &key) const {
+  uint64_t h = hashing(key);
+  h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+  h ^= h >> 31;
+
+  return *shards[(h >> 32) % shards.size()];
+}
+
+template <typename Key, typename Value, typename Shard, typename Hash>
+std::unique_lock<std::mutex>
+ConcurrentShardedHashTable<Key, Value, Shard, Hash>::lock(
+    const ShardSlot &shard) {
+  shard.acquisitions.fetch_add(1, std::memory_order_relaxed);
+
+  std::unique_lock<std::mutex> guard(shard.mutex, std::try_to_lock);
+
+  if (!guard.owns_lock()) {
+    auto start = std::chrono::steady_clock::now();
+    guard.lock();
+    auto waited = std::chrono::steady_clock::now() - start;
+
+    shard.contendedAcquisitions.fetch_add(1, std::memory_order_relaxed);
+    shard.waitNanoseconds.fetch_add(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(waited).count(),
+        std::memory_order_relaxed);
+  }
+
+  return guard;
+}
+
+template <typename Key, typename Value, typename Shard, typename Hash>
+ConcurrentShardedHashTable<Key, Value, Shard, Hash>::ConcurrentShardedHashTable(
+    size_t shardsCount, size_t shardSize) {
+  if (shardsCount == 0)
+    throw std::invalid_argument("A sharded table requires at least one shard.");
+
+  shards.reserve(shardsCount);
+  for (size_t i = 0; i < shardsCount; i++)
+    shards.push_back(std::make_unique<ShardSlot>(shardSize));
+}
+
+template <typename Key, typename Value, typename Shard, typename Hash>
+void ConcurrentShardedHashTable<Key, Value, Shard, Hash>::insert(
+    const Key &key, const Value &value) {
+  ShardSlot &shard = shardOf(key);
+  auto guard = lock(shard);
+  shard.table.insert(key, value);
+}
+
+template <typename Key, typename Value, typename Shard, typename Hash>
+bool ConcurrentShardedHashTable<Key, Value, Shard, Hash>::find(
+    const Key &key, Value &outValue) const {
+  const ShardSlot &shard = shardOf(key);
+  auto guard = lock(shard);
+  return shard.table.find(key, outValue);
+}
+
+template <typename Key, typename Value, typename Shard, typename Hash>
+void ConcurrentShardedHashTable<Key, Value, Shard, Hash>::update(
+    const Key &key, const Value &value) {
+  ShardSlot &shard = shardOf(key);
+  auto guard = lock(shard);
+  shard.table.update(key, value);
+}
+
+template <typename Key, typename Value, typename Shard, typename Hash>
+void ConcurrentShardedHashTable<Key, Value, Shard, Hash>::remove(
+    const Key &key) {
+  ShardSlot &shard = shardOf(key);
+  auto guard = lock(shard);
+  shard.table.remove(key);
+}
+
+template <typename Key, typename Value, typename Shard, typename Hash>
+void ConcurrentShardedHashTable<Key, Value, Shard, Hash>::clear() {
+  for (auto &shard : shards) {
+    std::lock_guard<std::mutex> guard(shard->mutex);
+    shard->table.clear();
+    shard->acquisitions.store(0, std::memory_order_relaxed);
+    shard->contendedAcquisitions.store(0, std::memory_order_relaxed);
+    shard->waitNanoseconds.store(0, std::memory_order_relaxed);
+  }
+}
+
+template <typename Key, typename Value, typename Shard, typename Hash>
+void ConcurrentShardedHashTable<Key, Value, Shard, Hash>::reserve(size_t n) {
+  size_t share = n / shards.size() + 1;
+
+  for (auto &shard : shards) {
+    std::lock_guard<std::mutex> guard(shard->mutex);
+    shard->table.reserve(share);
+  }
+}
+
+template <typename Key, typename Value, typename Shard, typename Hash>
+void ConcurrentShardedHashTable<Key, Value, Shard, Hash>::shrinkToFit() {
+  for (auto &shard : shards) {
+    std::lock_guard<std::mutex> guard(shard->mutex);
+    shard->table.shrinkToFit();
+  }
+}
+
+template <typename Key, typename Value, typename Shard, typename Hash>
+void ConcurrentShardedHashTable<Key, Value, Shard, Hash>::printInOrder(
+    std::ostream &out) const {
+  size_t maxKeyLen = 0, maxValLen = 0;
+  std::vector<std::pair<Key, Value>> vec;
+
+  forEach([&](const Key &key, const Value &value) {
+    vec.emplace_back(key, value);
+    maxKeyLen = std::max(maxKeyLen, StringHandler::size(key));
+    maxValLen = std::max(maxValLen, StringHandler::size(value));
+  });
+
+  std::sort(vec.begin(), vec.end(),
+            [](const auto &pa, const auto &pb) { return pa.first < pb.first; });
+
+  for (const auto &p : vec) {
+    out << StringHandler::SetWidthAtLeft(p.first, maxKeyLen) << " | "
+        << StringHandler::SetWidthAtLeft(p.second, maxValLen) << "\n";
+  }
+}
+
+template <typename Key, typename Value, typename Shard, typename Hash>
+void ConcurrentShardedHashTable<Key, Value, Shard, Hash>::forEach(
+    const std::function<void(const Key &, const Value &)> &action) const {
+  for (const auto &shard : shards) {
+    std::lock_guard<std::mutex> guard(shard->mutex);
+    shard->table.forEach(action);
+  }
+}
+
+template <typename Key, typename Value, typename Shard, typename Hash>
+size_t
+ConcurrentShardedHashTable<Key, Value, Shard, Hash>::getComparisonsCount()
+    const {
+  size_t total = 0;
+
+  for (const auto &shard : shards) {
+    std::lock_guard<std::mutex> guard(shard->mutex);
+    total += shard->table.getComparisonsCount();
+  }
+
+  return total;
+}
+
+template <typename Key, typename Value, typename Shard, typename Hash>
+Value &ConcurrentShardedHashTable<Key, Value, Shard, Hash>::operator[](
+    const Key &key) {
+  ShardSlot &shard = shardOf(key);
+  auto guard = lock(shard);
+  return shard.table[key];
+}
+
+template <typename Key, typename Value, typename Shard, typename Hash>
+const Value &ConcurrentShardedHashTable<Key, Value, Shard, Hash>::operator[](
+    const Key &key) const {
+  const ShardSlot &shard = shardOf(key);
+  auto guard = lock(shard);
+  return std::as_const(shard.table)[key];
+}
+
+template <typename Key, typename Value, typename Shard, typename Hash>
+void ConcurrentShardedHashTable<Key, Value, Shard, Hash>::increment(
+    const Key &key, const Value &amount) {
+  ShardSlot &shard = shardOf(key);
+  auto guard = lock(shard);
+  shard.table.increment(key, amount);
+}
+
+template <typename Key, typename Value, typename Shard, typename Hash>
+bool ConcurrentShardedHashTable<Key, Value, Shard, Hash>::isThreadSafe()
+    const {
+  return true;
+}
+
+template <typename Key, typename Value, typename Shard, typename Hash>
+size_t
+ConcurrentShardedHashTable<Key, Value, Shard, Hash>::getShardsCount() const {
+  return shards.size();
+}
+
+template <typename Key, typename Value, typename Shard, typename Hash>
+const Shard &
+ConcurrentShardedHashTable<Key, Value, Shard, Hash>::getShard(
+    size_t index) const {
+  return shards.at(index)->table;
+}
+
+template <typename Key, typename Value, typename Shard, typename Hash>
+typename ConcurrentShardedHashTable<Key, Value, Shard, Hash>::LockStatistics
+ConcurrentShardedHashTable<Key, Value, Shard, Hash>::getLockStatistics()
+    const {
+  LockStatistics total{0, 0, std::chrono::nanoseconds(0)};
+
+  for (const auto &shard : shards) {
+    total.acquisitions += shard->acquisitions.load(std::memory_order_relaxed);
+    total.contendedAcquisitions +=
+        shard->contendedAcquisitions.load(std::memory_order_relaxed);
+    total.waitTime += std::chrono::nanoseconds(
+        shard->waitNanoseconds.load(std::memory_order_relaxed));
+  }
+
+  return total;
+}
+
+template <typename Key, typename Value, typename Shard, typename Hash>
+void ConcurrentShardedHashTable<Key, Value, Shard, Hash>::accept(
+    IDictionaryVisitor<Key, Value> &visitor) const {
+  visitor.collectMetrics(*this);
+}
+
+template <typename Key, typename Value, typename Shard, typename Hash>
+size_t
+ConcurrentShardedHashTable<Key, Value, Shard, Hash>::getMemoryUsage() const {
+  size_t total = shards.capacity() * sizeof(std::unique_ptr<ShardSlot>);
+
+  for (const auto &shard : shards) {
+    std::lock_guard<std::mutex> guard(shard->mutex);
+    total += sizeof(ShardSlot) - sizeof(Shard) + shard->table.getMemoryUsage();
+  }
+
+  return total;
+}
@@ -7,6 +7,7 @@
 #include <boost/locale.hpp>
 #include "Configs/Locale/Locale.hpp"
 #include "Configs/Locale/LocaleManager.hpp"
+#include "Utils/Hashing/StringHash.hpp"
 /**
  * @struct LexicalStr
  * @brief Wrapper for std::string with custom comparison operators.
@@ -102,7 +103,9 @@ struct LexicalStr {
  * @brief Specialization of std::hash for LexicalStr.
  *
  * Allows LexicalStr to be used as a key in unordered containers like
- * std::unordered_map or std::unordered_set.
+ * std::unordered_map or std::unordered_set. The string is hashed by the
+ * function selected in StringHash (`--hash`), `std::hash<std::string>` by
+ * default.
  */
 namespace std {
     template<>
@@ -113,7 +116,7 @@ namespace std {
          * @return A hash code based on its internal string.
          */
         std::size_t operator()(const LexicalStr& key) const noexcept {
-            return std::hash<std::string>{}(key.data);
+            return StringHash::hash(key.data.data(), key.data.size());
         }
     };
 }
@@ -2,7 +2,132 @@
 #define REPORT_DATA_HPP
 
 #include <chrono>
+#include <optional>
 #include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @struct ErrorBounds
+ * @brief Accuracy guarantees of an approximate dictionary.
+ *
+ * Every reported count exceeds the true one by at most `maxOverestimate`,
+ * which is no more than epsilon times the total of all counts, with
+ * probability at least 1 - delta (a delta of zero means the bound is
+ * deterministic).
+ */
+struct ErrorBounds {
+  /**
+   * @brief Bound on the overestimate, as a fraction of all counts.
+   */
+  double epsilon;
+
+  /**
+   * @brief Probability that a count exceeds the bound.
+   */
+  double delta;
+
+  /**
+   * @brief The bound on the overestimate for the counts reported, in absolute
+   * terms.
+   */
+  size_t maxOverestimate;
+};
+
+/**
+ * @struct LockContention
+ * @brief Lock usage of a dictionary shared by several threads.
+ */
+struct LockContention {
+  /**
+   * @brief Times a lock was acquired.
+   */
+  size_t acquisitions;
+
+  /**
+   * @brief Acquisitions that had to wait for another thread.
+   */
+  size_t contendedAcquisitions;
+
+  /**
+   * @brief Total time spent waiting for locks.
+   */
+  std::chrono::nanoseconds waitTime;
+};
+
+/**
+ * @struct ProbeStatistics
+ * @brief Lookups of an open addressing hash table and the memory they
+ * touched.
+ */
+struct ProbeStatistics {
+  /**
+   * @brief Number of lookups.
+   */
+  size_t lookups;
+
+  /**
+   * @brief Probes made by the lookups: one per slot, or one per group of
+   * slots for a group scan.
+   */
+  size_t probes;
+
+  /**
+   * @brief Cache lines touched by the lookups, an estimate of cache misses.
+   */
+  size_t cacheLines;
+};
+
+/**
+ * @struct ParallelMerge
+ * @brief Cost of counting into one dictionary per thread and merging them.
+ *
+ * The counters of the threads and those of the merge are kept apart; the
+ * report's comparisons and specific metric are their sums.
+ */
+struct ParallelMerge {
+  /**
+   * @brief Number of thread-local dictionaries.
+   */
+  size_t dictionaries;
+
+  /**
+   * @brief Number of levels of the pairwise merge.
+   */
+  size_t levels;
+
+  /**
+   * @brief Comparisons made by the threads while counting.
+   */
+  size_t workerComparisons;
+
+  /**
+   * @brief The specific metric of every thread-local dictionary, added
+   * together.
+   */
+  size_t workerSpecificMetric;
+
+  /**
+   * @brief Comparisons made while merging.
+   */
+  size_t mergeComparisons;
+
+  /**
+   * @brief Growth of the specific metric while merging.
+   */
+  size_t mergeSpecificMetric;
+
+  /**
+   * @brief Time spent merging.
+   */
+  std::chrono::milliseconds mergeTime;
+
+  /**
+   * @brief The probe statistics of every thread-local dictionary, merge
+   * included, added together; set only for open addressing tables.
+   */
+  std::optional<ProbeStatistics> probeStatistics;
+};
 
 /**
  * @struct ReportData
@@ -46,6 +171,17 @@ struct ReportData {
    */
   size_t totalWordsProcessed;
 
+  /**
+   * @brief Estimate of the number of distinct words, taken while reading the
+   * file rather than from the dictionary.
+   */
+  size_t estimatedVocabulary;
+
+  /**
+   * @brief Relative standard error of `estimatedVocabulary`.
+   */
+  double vocabularyStandardError;
+
   /**
    * @brief Name of the file associated with the report.
    *
@@ -61,6 +197,34 @@ struct ReportData {
   size_t maxKeyLength;
 
   float memoryUsage;
+
+  /**
+   * @brief Further metrics, printed in order after the performance metrics.
+   * @details Each pair holds the metric's name and its already formatted value
+   * (e.g. {"Thread 1", "comparações: 1200, inserções: 80"}).
+   */
+  std::vector<std::pair<std::string, std::string>> additionalMetrics;
+
+  /**
+   * @brief Error bounds of the reported counts, set only by approximate
+   * dictionaries.
+   */
+  std::optional<ErrorBounds> errorBounds;
+
+  /**
+   * @brief Lock usage, set only by dictionaries that lock.
+   */
+  std::optional<LockContention> lockContention;
+
+  /**
+   * @brief Lookup costs, set only by open addressing hash tables.
+   */
+  std::optional<ProbeStatistics> probeStatistics;
+
+  /**
+   * @brief Merge cost, set only when thread-local dictionaries were merged.
+   */
+  std::optional<ParallelMerge> parallelMerge;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,265 @@
+#ifndef COUNT_MIN_SKETCH_HPP
+#define COUNT_MIN_SKETCH_HPP
+
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <vector>
+
+#include "Dictionary/IDictionary.hpp"
+#include "Sketches/CountMin/TopKHeap.hpp"
+
+/**
+ * @brief An approximate dictionary of counts in fixed memory: a Count-Min
+ * Sketch (Cormode and Muthukrishnan) with conservative update, plus a heap of
+ * the heaviest keys.
+ *
+ * The sketch is a `depth` x `width` matrix of counters; every key maps to one
+ * counter per row. Counting a key raises its counters only as far as needed
+ * for the smallest of them to grow by the amount (conservative update), and
+ * the estimate of a key is the smallest of its counters. Estimates never fall
+ * short of the true count, and with width = ceil(e / epsilon) and
+ * depth = ceil(ln(1 / delta)) they exceed it by at most epsilon * N with
+ * probability at least 1 - delta, where N is the total of all counts.
+ *
+ * Since the sketch keeps no keys, the heaviest ones are tracked by a bounded
+ * heap, which holds the estimate of each key at its latest occurrence. Only
+ * those keys are printed. Memory is fixed at construction whatever the size of
+ * the vocabulary.
+ *
+ * Values are added, never replaced or removed: update(), remove() and the
+ * non-const operator[] throw UnsupportedOperationException. Counting goes
+ * through increment().
+ *
+ * @tparam Key The type of the keys.
+ * @tparam Value The type of the counts. Must be an arithmetic type.
+ * @tparam Hash The hash function to be used (defaults to std::hash<Key>).
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class CountMinSketch : public IDictionary<Key, Value> {
+public:
+  /**
+   * @brief Default bound on the overestimate, as a fraction of all counts.
+   */
+  static constexpr double DEFAULT_EPSILON = 0.0005;
+
+  /**
+   * @brief Default probability that an estimate exceeds the bound.
+   */
+  static constexpr double DEFAULT_DELTA = 0.01;
+
+  /**
+   * @brief Default number of heavy hitters tracked.
+   */
+  static const size_t DEFAULT_HEAVY_HITTERS = 2000;
+
+private:
+  /**
+   * @brief Bound on the overestimate, as a fraction of all counts.
+   */
+  double epsilon;
+
+  /**
+   * @brief Probability that an estimate exceeds the bound.
+   */
+  double delta;
+
+  /**
+   * @brief The number of counters per row.
+   */
+  size_t width;
+
+  /**
+   * @brief The number of rows, one hash function each.
+   */
+  size_t depth;
+
+  /**
+   * @brief The counters, row after row.
+   */
+  std::vector<Value> counters;
+
+  /**
+   * @brief The total of all counts added.
+   */
+  Value totalCount;
+
+  /**
+   * @brief Hash function object used to compute the counters of each key.
+   */
+  Hash hashing;
+
+  /**
+   * @brief The keys with the largest estimates.
+   */
+  TopKHeap<Key, Value, Hash> heavyHitters;
+
+  /**
+   * @brief Computes the two hash codes from which the counter of a key on
+   * each row is derived.
+   *
+   * The rows use the hash functions h1 + i * h2 (Kirsch and Mitzenmacher),
+   * where h1 is the key's hash and h2 is derived from it by a 64-bit
+   * finalizer.
+   *
+   * @param key The key.
+   * @param h1 Receives the first hash code.
+   * @param h2 Receives the second hash code, which is odd.
+   */
+  void hashCodes(const Key &key, uint64_t &h1, uint64_t &h2) const;
+
+  /**
+   * @brief Returns the position in `counters` of a key's counter on a row.
+   */
+  size_t counterIndex(uint64_t h1, uint64_t h2, size_t row) const;
+
+  /**
+   * @brief Returns the estimate of a key: the smallest of its counters.
+   */
+  Value estimate(uint64_t h1, uint64_t h2) const;
+
+public:
+  /**
+   * @brief Constructs an empty sketch sized for the given error bounds.
+   *
+   * @param epsilon Bound on the overestimate, as a fraction of all counts.
+   * @param delta Probability that an estimate exceeds the bound.
+   * @param heavyHitters The number of heaviest keys kept and printed.
+   * @throws std::invalid_argument If epsilon is not positive or delta is not
+   * in (0, 1).
+   */
+  explicit CountMinSketch(double epsilon = DEFAULT_EPSILON,
+                          double delta = DEFAULT_DELTA,
+                          size_t heavyHitters = DEFAULT_HEAVY_HITTERS);
+
+  /**
+   * @brief Adds a value to the count of a key.
+   *
+   * A sketch cannot tell whether a key was seen before, so this never throws
+   * KeyAlreadyExistsException; it is the same as increment().
+   *
+   * @param key The key.
+   * @param value The amount to add.
+   */
+  void insert(const Key &key, const Value &value) override;
+
+  /**
+   * @brief Estimates the count of a key.
+   *
+   * @param key The key to look for.
+   * @param outValue Receives the estimate, which is never below the true
+   * count.
+   * @return true if the estimate is positive; false otherwise.
+   */
+  bool find(const Key &key, Value &outValue) const override;
+
+  /**
+   * @brief Not supported: counts cannot be replaced.
+   *
+   * @throws UnsupportedOperationException Always.
+   */
+  void update(const Key &key, const Value &value) override;
+
+  /**
+   * @brief Not supported: counts cannot be removed.
+   *
+   * @throws UnsupportedOperationException Always.
+   */
+  void remove(const Key &key) override;
+
+  /**
+   * @brief Resets every counter and forgets the heavy hitters.
+   */
+  void clear() override;
+
+  /**
+   * @brief Prints the heavy hitters and their estimates, ordered by key.
+   *
+   * @param out The output stream.
+   */
+  void printInOrder(std::ostream &out) const override;
+
+  /**
+   * @brief Calls a function on every key-value pair, monitored heavy hitter, in no particular order.
+   *
+   * @param action The function called with each key and value.
+   */
+  void forEach(const std::function<void(const Key &, const Value &)> &action)
+      const override;
+
+  /**
+   * @brief Returns the counter comparisons made by the conservative updates
+   * and by the heap.
+   */
+  size_t getComparisonsCount() const override;
+
+  /**
+   * @brief Not supported: there is no stored value to refer to.
+   *
+   * @throws UnsupportedOperationException Always.
+   */
+  Value &operator[](const Key &key) override;
+
+  /**
+   * @brief Returns the estimate held for a heavy hitter.
+   *
+   * @param key The key to access.
+   * @return const Value& The estimate of the key.
+   * @throws KeyNotFoundException If the key is not a heavy hitter.
+   */
+  const Value &operator[](const Key &key) const override;
+
+  /**
+   * @brief Adds an amount to the count of a key with a conservative update.
+   *
+   * @param key The key whose count is incremented.
+   * @param amount The amount to add.
+   */
+  void increment(const Key &key, const Value &amount) override;
+
+  /**
+   * @brief Returns the bound on the overestimate, as a fraction of all counts.
+   */
+  double getEpsilon() const;
+
+  /**
+   * @brief Returns the probability that an estimate exceeds the bound.
+   */
+  double getDelta() const;
+
+  /**
+   * @brief Returns the number of counters per row.
+   */
+  size_t getWidth() const;
+
+  /**
+   * @brief Returns the number of rows.
+   */
+  size_t getDepth() const;
+
+  /**
+   * @brief Returns the largest overestimate allowed by the bounds so far,
+   * ceil(epsilon * N).
+   */
+  size_t getMaxOverestimate() const;
+
+  /**
+   * @brief Returns the number of heavy hitters currently tracked.
+   */
+  size_t getHeavyHittersCount() const;
+
+  /**
+   * @brief Accepts a visitor implementing IDictionaryVisitor interface to
+   * collect metrics or perform operations on the CountMinSketch.
+   *
+   * @param visitor A reference to an IDictionaryVisitor<Key, Value> object that
+   * will interact with the CountMinSketch.
+   */
+  void accept(IDictionaryVisitor<Key, Value> &visitor) const override;
+
+  size_t getMemoryUsage() const override;
+};
+
+#include "Sketches/CountMin/CountMinSketch.impl.hpp"
+
+#endif
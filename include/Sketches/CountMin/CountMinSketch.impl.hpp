@@ -0,0 +1,201 @@
+#include "Sketches/CountMin/CountMinSketch.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "Exceptions/DictionaryExceptions.hpp"
+#include "Exceptions/KeyExceptions.hpp"
+#include "Utils/Strings/StringHandler.hpp"
+
+template <typename Key, typename Value, typename Hash>
+void CountMinSketch<Key, Value, Hash>::hashCodes(const Key &key, uint64_t &h1,
+                                                 uint64_t &h2) const {
+  h1 = hashing(key);
+
+  // splitmix64 finalizer
+  h2 = h1 + 0x9e3779b97f4a7c15ULL;
+  h2 = (h2 ^ (h2 >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  h2 = (h2 ^ (h2 >> 27)) * 0x94d049bb133111ebULL;
+  h2 = (h2 ^ (h2 >> 31)) | 1;
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t CountMinSketch<Key, Value, Hash>::counterIndex(uint64_t h1, uint64_t h2,
+                                                      size_t row) const {
+  return row * width + (h1 + row * h2) % width;
+}
+
+template <typename Key, typename Value, typename Hash>
+Value CountMinSketch<Key, Value, Hash>::estimate(uint64_t h1,
+                                                 uint64_t h2) const {
+  Value smallest = counters[counterIndex(h1, h2, 0)];
+
+  for (size_t row = 1; row < depth; row++) {
+    smallest = std::min(smallest, counters[counterIndex(h1, h2, row)]);
+    this->incrementCounter(1);
+  }
+
+  return smallest;
+}
+
+template <typename Key, typename Value, typename Hash>
+CountMinSketch<Key, Value, Hash>::CountMinSketch(double epsilon, double delta,
+                                                 size_t heavyHitters)
+    : epsilon(epsilon), delta(delta), totalCount(), heavyHitters(heavyHitters) {
+  if (!(epsilon > 0) or !(delta > 0 and delta < 1))
+    throw std::invalid_argument("Count-Min Sketch requires epsilon > 0 and "
+                                "0 < delta < 1.");
+
+  width = static_cast<size_t>(std::ceil(std::exp(1.0) / epsilon));
+  depth = std::max<size_t>(1, std::ceil(std::log(1 / delta)));
+  counters.assign(width * depth, Value());
+}
+
+template <typename Key, typename Value, typename Hash>
+void CountMinSketch<Key, Value, Hash>::insert(const Key &key,
+                                              const Value &value) {
+  increment(key, value);
+}
+
+template <typename Key, typename Value, typename Hash>
+bool CountMinSketch<Key, Value, Hash>::find(const Key &key,
+                                            Value &outValue) const {
+  // The heap holds the estimate at the key's latest occurrence, which is
+  // tighter than the current one: later keys may only have raised it.
+  if (const Value *count = heavyHitters.find(key)) {
+    outValue = *count;
+    return true;
+  }
+
+  uint64_t h1, h2;
+  hashCodes(key, h1, h2);
+  outValue = estimate(h1, h2);
+
+  return outValue > Value();
+}
+
+template <typename Key, typename Value, typename Hash>
+void CountMinSketch<Key, Value, Hash>::update(const Key &, const Value &) {
+  throw UnsupportedOperationException();
+}
+
+template <typename Key, typename Value, typename Hash>
+void CountMinSketch<Key, Value, Hash>::remove(const Key &) {
+  throw UnsupportedOperationException();
+}
+
+template <typename Key, typename Value, typename Hash>
+void CountMinSketch<Key, Value, Hash>::clear() {
+  std::fill(counters.begin(), counters.end(), Value());
+  totalCount = Value();
+  heavyHitters.clear();
+  this->resetCounter();
+}
+
+template <typename Key, typename Value, typename Hash>
+void CountMinSketch<Key, Value, Hash>::printInOrder(std::ostream &out) const {
+  std::vector<std::pair<Key, Value>> pairs = heavyHitters.entries();
+  std::sort(pairs.begin(), pairs.end(),
+            [](const std::pair<Key, Value> &a, const std::pair<Key, Value> &b) {
+              return a.first < b.first;
+            });
+
+  size_t keyWidth = 0, valueWidth = 0;
+
+  for (const auto &[key, value] : pairs) {
+    keyWidth = std::max(keyWidth, StringHandler::size(key));
+    valueWidth = std::max(valueWidth, StringHandler::size(value));
+  }
+
+  for (const auto &[key, value] : pairs)
+    out << StringHandler::SetWidthAtLeft(key, keyWidth) << " | "
+        << StringHandler::SetWidthAtLeft(value, valueWidth) << '\n';
+}
+
+template <typename Key, typename Value, typename Hash>
+void CountMinSketch<Key, Value, Hash>::forEach(
+    const std::function<void(const Key &, const Value &)> &action) const {
+  for (const auto &[key, value] : heavyHitters.entries())
+    action(key, value);
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t CountMinSketch<Key, Value, Hash>::getComparisonsCount() const {
+  return this->comparisonsCount + heavyHitters.getComparisonsCount();
+}
+
+template <typename Key, typename Value, typename Hash>
+Value &CountMinSketch<Key, Value, Hash>::operator[](const Key &) {
+  throw UnsupportedOperationException();
+}
+
+template <typename Key, typename Value, typename Hash>
+const Value &
+CountMinSketch<Key, Value, Hash>::operator[](const Key &key) const {
+  const Value *count = heavyHitters.find(key);
+
+  if (!count)
+    throw KeyNotFoundException();
+
+  return *count;
+}
+
+template <typename Key, typename Value, typename Hash>
+void CountMinSketch<Key, Value, Hash>::increment(const Key &key,
+                                                 const Value &amount) {
+  uint64_t h1, h2;
+  hashCodes(key, h1, h2);
+
+  Value target = estimate(h1, h2) + amount;
+
+  for (size_t row = 0; row < depth; row++) {
+    Value &counter = counters[counterIndex(h1, h2, row)];
+    counter = std::max(counter, target);
+  }
+  this->incrementCounter(depth);
+
+  totalCount += amount;
+  heavyHitters.offer(key, target);
+}
+
+template <typename Key, typename Value, typename Hash>
+double CountMinSketch<Key, Value, Hash>::getEpsilon() const {
+  return epsilon;
+}
+
+template <typename Key, typename Value, typename Hash>
+double CountMinSketch<Key, Value, Hash>::getDelta() const {
+  return delta;
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t CountMinSketch<Key, Value, Hash>::getWidth() const {
+  return width;
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t CountMinSketch<Key, Value, Hash>::getDepth() const {
+  return depth;
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t CountMinSketch<Key, Value, Hash>::getMaxOverestimate() const {
+  return static_cast<size_t>(std::ceil(epsilon * totalCount));
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t CountMinSketch<Key, Value, Hash>::getHeavyHittersCount() const {
+  return heavyHitters.size();
+}
+
+template <typename Key, typename Value, typename Hash>
+void CountMinSketch<Key, Value, Hash>::accept(
+    IDictionaryVisitor<Key, Value> &visitor) const {
+  visitor.collectMetrics(*this);
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t CountMinSketch<Key, Value, Hash>::getMemoryUsage() const {
+  return counters.capacity() * sizeof(Value) + heavyHitters.getMemoryUsage();
+}
@@ -0,0 +1,115 @@
+#ifndef TOP_K_HEAP_HPP
+#define TOP_K_HEAP_HPP
+
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief A bounded min-heap that keeps the k keys with the largest counts.
+ *
+ * The heap is indexed by a hash map from each key to its position, so the
+ * count of a key already in the heap can be raised in O(log k) instead of
+ * being pushed a second time. Once k keys are held, a new key enters only if
+ * its count exceeds the smallest one, which it then evicts.
+ *
+ * Counts offered for a key must never decrease.
+ *
+ * @tparam Key The type of the keys.
+ * @tparam Value The type of the counts.
+ * @tparam Hash The hash function of the index (defaults to std::hash<Key>).
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class TopKHeap {
+  /**
+   * @brief The entries, ordered as a binary min-heap by count.
+   */
+  std::vector<std::pair<Key, Value>> heap;
+
+  /**
+   * @brief The position in `heap` of each key it holds.
+   */
+  std::unordered_map<Key, size_t, Hash> positions;
+
+  /**
+   * @brief The maximum number of keys held.
+   */
+  size_t capacity;
+
+  /**
+   * @brief Count comparisons made while maintaining the heap.
+   */
+  size_t comparisonsCount;
+
+  /**
+   * @brief Swaps two entries and records their new positions.
+   */
+  void swapEntries(size_t i, size_t j);
+
+  /**
+   * @brief Moves an entry up while it is smaller than its parent.
+   */
+  void siftUp(size_t i);
+
+  /**
+   * @brief Moves an entry down while it is larger than one of its children.
+   */
+  void siftDown(size_t i);
+
+public:
+  /**
+   * @brief Constructs an empty heap that holds up to `capacity` keys.
+   *
+   * @param capacity The number of keys kept.
+   */
+  explicit TopKHeap(size_t capacity);
+
+  /**
+   * @brief Records the current count of a key.
+   *
+   * If the key is held its count is raised; otherwise it is added when there
+   * is room, or when its count exceeds the smallest count held.
+   *
+   * @param key The key.
+   * @param count The current count of the key.
+   */
+  void offer(const Key &key, const Value &count);
+
+  /**
+   * @brief Returns the count held for a key.
+   *
+   * @param key The key to look for.
+   * @return const Value* The count, or nullptr if the key is not held.
+   */
+  const Value *find(const Key &key) const;
+
+  /**
+   * @brief Returns the entries held, in heap order.
+   */
+  const std::vector<std::pair<Key, Value>> &entries() const;
+
+  /**
+   * @brief Returns the number of keys held.
+   */
+  size_t size() const;
+
+  /**
+   * @brief Removes every key.
+   */
+  void clear();
+
+  /**
+   * @brief Returns the count comparisons made so far.
+   */
+  size_t getComparisonsCount() const;
+
+  /**
+   * @brief Returns the bytes reserved for `capacity` entries and their index.
+   */
+  size_t getMemoryUsage() const;
+};
+
+#include "Sketches/CountMin/TopKHeap.impl.hpp"
+
+#endif
@@ -0,0 +1,127 @@
+#include "Sketches/CountMin/TopKHeap.hpp"
+
+template <typename Key, typename Value, typename Hash>
+void TopKHeap<Key, Value, Hash>::swapEntries(size_t i, size_t j) {
+  std::swap(heap[i], heap[j]);
+  positions[heap[i].first] = i;
+  positions[heap[j].first] = j;
+}
+
+template <typename Key, typename Value, typename Hash>
+void TopKHeap<Key, Value, Hash>::siftUp(size_t i) {
+  while (i > 0) {
+    size_t parent = (i - 1) / 2;
+
+    comparisonsCount++;
+    if (!(heap[i].second < heap[parent].second))
+      break;
+
+    swapEntries(i, parent);
+    i = parent;
+  }
+}
+
+template <typename Key, typename Value, typename Hash>
+void TopKHeap<Key, Value, Hash>::siftDown(size_t i) {
+  while (true) {
+    size_t smallest = i, left = 2 * i + 1, right = 2 * i + 2;
+
+    if (left < heap.size()) {
+      comparisonsCount++;
+      if (heap[left].second < heap[smallest].second)
+        smallest = left;
+    }
+
+    if (right < heap.size()) {
+      comparisonsCount++;
+      if (heap[right].second < heap[smallest].second)
+        smallest = right;
+    }
+
+    if (smallest == i)
+      break;
+
+    swapEntries(i, smallest);
+    i = smallest;
+  }
+}
+
+template <typename Key, typename Value, typename Hash>
+TopKHeap<Key, Value, Hash>::TopKHeap(size_t capacity)
+    : capacity(capacity), comparisonsCount(0) {
+  heap.reserve(capacity);
+  positions.reserve(capacity);
+}
+
+template <typename Key, typename Value, typename Hash>
+void TopKHeap<Key, Value, Hash>::offer(const Key &key, const Value &count) {
+  auto it = positions.find(key);
+
+  if (it != positions.end()) {
+    heap[it->second].second = count;
+    siftDown(it->second);
+    return;
+  }
+
+  if (heap.size() < capacity) {
+    heap.emplace_back(key, count);
+    positions[key] = heap.size() - 1;
+    siftUp(heap.size() - 1);
+    return;
+  }
+
+  if (heap.empty())
+    return;
+
+  comparisonsCount++;
+  if (!(heap.front().second < count))
+    return;
+
+  positions.erase(heap.front().first);
+  heap.front() = {key, count};
+  positions[key] = 0;
+  siftDown(0);
+}
+
+template <typename Key, typename Value, typename Hash>
+const Value *TopKHeap<Key, Value, Hash>::find(const Key &key) const {
+  auto it = positions.find(key);
+
+  if (it == positions.end())
+    return nullptr;
+
+  return &heap[it->second].second;
+}
+
+template <typename Key, typename Value, typename Hash>
+const std::vector<std::pair<Key, Value>> &
+TopKHeap<Key, Value, Hash>::entries() const {
+  return heap;
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t TopKHeap<Key, Value, Hash>::size() const {
+  return heap.size();
+}
+
+template <typename Key, typename Value, typename Hash>
+void TopKHeap<Key, Value, Hash>::clear() {
+  heap.clear();
+  positions.clear();
+  comparisonsCount = 0;
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t TopKHeap<Key, Value, Hash>::getComparisonsCount() const {
+  return comparisonsCount;
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t TopKHeap<Key, Value, Hash>::getMemoryUsage() const {
+  // Each index entry is a hash node holding the pair, a next pointer and the
+  // cached hash code.
+  size_t indexNode = sizeof(std::pair<const Key, size_t>) + 2 * sizeof(void *);
+
+  return capacity * (sizeof(std::pair<Key, Value>) + indexNode) +
+         positions.bucket_count() * sizeof(void *);
+}
@@ -0,0 +1,101 @@
+#ifndef HYPER_LOG_LOG_HPP
+#define HYPER_LOG_LOG_HPP
+
+#include <array>
+#include <cstdint>
+#include <functional>
+
+/**
+ * @brief An estimator of the number of distinct keys in a stream (Flajolet et
+ * al.'s HyperLogLog, with the 64-bit hashing of Heule et al.'s HLL++).
+ *
+ * Each key is hashed to 64 bits; the top PRECISION bits choose one of
+ * 2^PRECISION registers, which keeps the largest position of the first set bit
+ * seen in the remaining ones. The harmonic mean of the registers estimates
+ * the cardinality with a standard error of about 1.04 / sqrt(2^PRECISION),
+ * 1.6% for 4096 one-byte registers. Small cardinalities, while registers are
+ * still empty, are estimated by linear counting instead.
+ *
+ * A 64-bit hash needs no large-range correction. HLL++'s empirical
+ * bias-correction tables are not included, so the switch from linear counting
+ * happens at the original 5/2 * 2^PRECISION.
+ *
+ * @tparam Key The type of the keys.
+ * @tparam Hash The hash function to be used (defaults to std::hash<Key>).
+ */
+template <typename Key, typename Hash = std::hash<Key>> class HyperLogLog {
+public:
+  /**
+   * @brief The number of hash bits used to choose a register.
+   */
+  static const unsigned PRECISION = 12;
+
+  /**
+   * @brief The number of registers.
+   */
+  static const size_t REGISTERS = size_t(1) << PRECISION;
+
+private:
+  /**
+   * @brief The largest rank seen by each register.
+   */
+  std::array<uint8_t, REGISTERS> registers;
+
+  /**
+   * @brief Hash function object applied to the keys before mixing.
+   */
+  Hash hashing;
+
+  /**
+   * @brief Spreads the bits of a hash code with the splitmix64 finalizer, so
+   * that weak hash functions still fill the registers evenly.
+   */
+  static uint64_t mix(uint64_t h);
+
+public:
+  /**
+   * @brief Constructs an estimator that has seen no key.
+   */
+  HyperLogLog();
+
+  /**
+   * @brief Records one occurrence of a key.
+   *
+   * @param key The key.
+   */
+  void add(const Key &key);
+
+  /**
+   * @brief Estimates the number of distinct keys recorded.
+   *
+   * @return size_t The estimated cardinality.
+   */
+  size_t estimate() const;
+
+  /**
+   * @brief Returns an estimate three standard errors above estimate(), which
+   * exceeds the true cardinality with high probability.
+   *
+   * Meant for sizing structures before the keys are counted.
+   */
+  size_t upperBound() const;
+
+  /**
+   * @brief Returns the relative standard error of the estimates.
+   */
+  static double getStandardError();
+
+  /**
+   * @brief Forgets every key recorded.
+   */
+  void clear();
+
+  /**
+   * @brief Returns the bytes used by the registers.
+   */
+  size_t getMemoryUsage() const;
+};
+
+#include "Sketches/HyperLogLog/HyperLogLog.impl.hpp"
+
+#endif
@@ -0,0 +1,73 @@
+#include "Sketches/HyperLogLog/HyperLogLog.hpp"
+
+#include <cmath>
+
+template <typename Key, typename Hash>
+uint64_t HyperLogLog<Key, Hash>::mix(uint64_t h) {
+  h += 0x9e3779b97f4a7c15ULL;
+  h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+  return h ^ (h >> 31);
+}
+
+template <typename Key, typename Hash> HyperLogLog<Key, Hash>::HyperLogLog() {
+  clear();
+}
+
+template <typename Key, typename Hash>
+void HyperLogLog<Key, Hash>::add(const Key &key) {
+  uint64_t h = mix(hashing(key));
+  size_t index = h >> (64 - PRECISION);
+
+  // The sentinel bit bounds the rank at 64 - PRECISION + 1 when the
+  // remaining bits are all zero.
+  uint64_t rest = (h << PRECISION) | (uint64_t(1) << (PRECISION - 1));
+  uint8_t rank = __builtin_clzll(rest) + 1;
+
+  if (rank > registers[index])
+    registers[index] = rank;
+}
+
+template <typename Key, typename Hash>
+size_t HyperLogLog<Key, Hash>::estimate() const {
+  const double m = REGISTERS;
+  const double alpha = 0.7213 / (1 + 1.079 / m);
+
+  double sum = 0;
+  size_t zeros = 0;
+
+  for (uint8_t rank : registers) {
+    sum += std::ldexp(1.0, -rank);
+    zeros += rank == 0;
+  }
+
+  double raw = alpha * m * m / sum;
+
+  if (zeros > 0) {
+    double linear = m * std::log(m / zeros);
+    if (linear <= 2.5 * m)
+      return static_cast<size_t>(std::llround(linear));
+  }
+
+  return static_cast<size_t>(std::llround(raw));
+}
+
+template <typename Key, typename Hash>
+size_t HyperLogLog<Key, Hash>::upperBound() const {
+  return static_cast<size_t>(
+      std::ceil(estimate() * (1 + 3 * getStandardError())));
+}
+
+template <typename Key, typename Hash>
+double HyperLogLog<Key, Hash>::getStandardError() {
+  return 1.04 / std::sqrt(static_cast<double>(REGISTERS));
+}
+
+template <typename Key, typename Hash> void HyperLogLog<Key, Hash>::clear() {
+  registers.fill(0);
+}
+
+template <typename Key, typename Hash>
+size_t HyperLogLog<Key, Hash>::getMemoryUsage() const {
+  return sizeof(registers);
+}
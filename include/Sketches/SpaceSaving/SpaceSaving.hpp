@@ -0,0 +1,255 @@
+#ifndef SPACE_SAVING_HPP
+#define SPACE_SAVING_HPP
+
+#include <functional>
+#include <iostream>
+#include <unordered_map>
+#include <vector>
+
+#include "Dictionary/IDictionary.hpp"
+#include "Sketches/SpaceSaving/StreamSummaryNodes.hpp"
+
+/**
+ * @brief A streaming top-k counter (Metwally, Agrawal and El Abbadi's
+ * Space-Saving) over the stream-summary structure.
+ *
+ * Exactly k keys are monitored. A key that is not monitored replaces the one
+ * with the smallest count, inheriting that count as its error, so every
+ * reported count c with error e brackets the true count within [c - e, c], and
+ * no key outside the summary occurs more than the smallest count, which is at
+ * most N / k for N counted occurrences.
+ *
+ * Counters are grouped into buckets of equal count, kept in increasing order,
+ * so counting one more occurrence moves a counter to the next bucket in
+ * constant time. All counters and buckets are allocated at construction.
+ *
+ * Counts are added, never replaced or removed: update(), remove() and the
+ * non-const operator[] throw UnsupportedOperationException. Counting goes
+ * through increment().
+ *
+ * @tparam Key The type of the keys.
+ * @tparam Value The type of the counts. Must be an arithmetic type.
+ * @tparam Hash The hash function of the key index (defaults to
+ * std::hash<Key>).
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class SpaceSaving : public IDictionary<Key, Value> {
+public:
+  /**
+   * @brief Default number of monitored keys.
+   */
+  static const size_t DEFAULT_CAPACITY = 2000;
+
+private:
+  using Counter = StreamSummaryCounter<Key, Value>;
+  using Bucket = StreamSummaryBucket<Key, Value>;
+
+  /**
+   * @brief The number of monitored keys.
+   */
+  size_t capacity;
+
+  /**
+   * @brief The counters, reserved for `capacity` keys so that they never move.
+   */
+  std::vector<Counter> counters;
+
+  /**
+   * @brief The buckets, one more than the counters so that a new bucket can
+   * be linked before an emptied one is released.
+   */
+  std::vector<Bucket> buckets;
+
+  /**
+   * @brief Buckets not in use.
+   */
+  std::vector<Bucket *> freeBuckets;
+
+  /**
+   * @brief The bucket with the smallest count.
+   */
+  Bucket *smallest;
+
+  /**
+   * @brief The counter of each monitored key.
+   */
+  std::unordered_map<Key, Counter *, Hash> index;
+
+  /**
+   * @brief The total of all counts added.
+   */
+  Value totalCount;
+
+  /**
+   * @brief The number of monitored keys replaced by new ones.
+   */
+  size_t evictionsCount;
+
+  /**
+   * @brief Takes a bucket from the free list and links it between two
+   * buckets.
+   */
+  Bucket *newBucket(const Value &count, Bucket *prev, Bucket *next);
+
+  /**
+   * @brief Unlinks a counter from its bucket, releasing the bucket if it
+   * becomes empty.
+   */
+  void detach(Counter *counter);
+
+  /**
+   * @brief Moves a counter to the bucket of a larger count, creating it if
+   * needed.
+   *
+   * The search for the bucket starts right after the counter's current one,
+   * so a unit increment takes constant time.
+   *
+   * @param counter The counter, attached to a bucket or detached.
+   * @param count The new count, larger than the current one.
+   */
+  void moveTo(Counter *counter, const Value &count);
+
+  /**
+   * @brief Returns the counter of a key, or nullptr if it is not monitored.
+   */
+  const Counter *findCounter(const Key &key) const;
+
+public:
+  /**
+   * @brief Constructs an empty summary that monitors up to `capacity` keys.
+   *
+   * @param capacity The number of counters.
+   * @throws std::invalid_argument If `capacity` is zero.
+   */
+  explicit SpaceSaving(size_t capacity = DEFAULT_CAPACITY);
+
+  SpaceSaving(const SpaceSaving &) = delete;
+  SpaceSaving &operator=(const SpaceSaving &) = delete;
+
+  /**
+   * @brief Adds a value to the count of a key; the same as increment().
+   *
+   * @param key The key.
+   * @param value The amount to add.
+   */
+  void insert(const Key &key, const Value &value) override;
+
+  /**
+   * @brief Retrieves the count of a monitored key.
+   *
+   * @param key The key to look for.
+   * @param outValue Receives the count, which never falls short of the true
+   * count.
+   * @return true if the key is monitored; false otherwise.
+   */
+  bool find(const Key &key, Value &outValue) const override;
+
+  /**
+   * @brief Not supported: counts cannot be replaced.
+   *
+   * @throws UnsupportedOperationException Always.
+   */
+  void update(const Key &key, const Value &value) override;
+
+  /**
+   * @brief Not supported: counts cannot be removed.
+   *
+   * @throws UnsupportedOperationException Always.
+   */
+  void remove(const Key &key) override;
+
+  /**
+   * @brief Forgets every monitored key.
+   */
+  void clear() override;
+
+  /**
+   * @brief Prints the monitored keys ordered by key, each with its count and
+   * the most the count may exceed the true one.
+   *
+   * @param out The output stream.
+   */
+  void printInOrder(std::ostream &out) const override;
+
+  /**
+   * @brief Calls a function on every key-value pair, monitored key and its count, in no particular order.
+   *
+   * @param action The function called with each key and value.
+   */
+  void forEach(const std::function<void(const Key &, const Value &)> &action)
+      const override;
+
+  /**
+   * @brief Returns the count comparisons made while looking for buckets.
+   */
+  size_t getComparisonsCount() const override;
+
+  /**
+   * @brief Not supported: counts can only be incremented.
+   *
+   * @throws UnsupportedOperationException Always.
+   */
+  Value &operator[](const Key &key) override;
+
+  /**
+   * @brief Returns the count of a monitored key.
+   *
+   * @param key The key to access.
+   * @return const Value& The count of the key.
+   * @throws KeyNotFoundException If the key is not monitored.
+   */
+  const Value &operator[](const Key &key) const override;
+
+  /**
+   * @brief Adds an amount to the count of a key, replacing the key with the
+   * smallest count if the key is not monitored and the summary is full.
+   *
+   * Unit increments take constant time; larger ones walk past the buckets
+   * whose counts they skip.
+   *
+   * @param key The key whose count is incremented.
+   * @param amount The amount to add.
+   */
+  void increment(const Key &key, const Value &amount) override;
+
+  /**
+   * @brief Returns the most the count of a monitored key may exceed its true
+   * count.
+   *
+   * @param key The key.
+   * @return Value The error of the key's count.
+   * @throws KeyNotFoundException If the key is not monitored.
+   */
+  Value getError(const Key &key) const;
+
+  /**
+   * @brief Returns the number of counters.
+   */
+  size_t getCapacity() const;
+
+  /**
+   * @brief Returns the smallest monitored count, which bounds both the count
+   * of any key outside the summary and every error.
+   */
+  Value getMinimumCount() const;
+
+  /**
+   * @brief Returns the number of monitored keys replaced by new ones.
+   */
+  size_t getEvictionsCount() const;
+
+  /**
+   * @brief Accepts a visitor implementing IDictionaryVisitor interface to
+   * collect metrics or perform operations on the SpaceSaving summary.
+   *
+   * @param visitor A reference to an IDictionaryVisitor<Key, Value> object that
+   * will interact with the SpaceSaving summary.
+   */
+  void accept(IDictionaryVisitor<Key, Value> &visitor) const override;
+
+  size_t getMemoryUsage() const override;
+};
+
+#include "Sketches/SpaceSaving/SpaceSaving.impl.hpp"
+
+#endif
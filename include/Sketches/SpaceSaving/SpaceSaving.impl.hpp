@@ -0,0 +1,298 @@
+#include "Sketches/SpaceSaving/SpaceSaving.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+
+#include "Exceptions/DictionaryExceptions.hpp"
+#include "Exceptions/KeyExceptions.hpp"
+#include "Utils/Strings/StringHandler.hpp"
+
+template <typename Key, typename Value, typename Hash>
+StreamSummaryBucket<Key, Value> *
+SpaceSaving<Key, Value, Hash>::newBucket(const Value &count, Bucket *prev,
+                                         Bucket *next) {
+  Bucket *bucket = freeBuckets.back();
+  freeBuckets.pop_back();
+
+  bucket->count = count;
+  bucket->counters = nullptr;
+  bucket->prev = prev;
+  bucket->next = next;
+
+  if (prev)
+    prev->next = bucket;
+  else
+    smallest = bucket;
+
+  if (next)
+    next->prev = bucket;
+
+  return bucket;
+}
+
+template <typename Key, typename Value, typename Hash>
+void SpaceSaving<Key, Value, Hash>::detach(Counter *counter) {
+  Bucket *bucket = counter->bucket;
+
+  if (!bucket)
+    return;
+
+  if (counter->prev)
+    counter->prev->next = counter->next;
+  else
+    bucket->counters = counter->next;
+
+  if (counter->next)
+    counter->next->prev = counter->prev;
+
+  counter->bucket = nullptr;
+  counter->prev = counter->next = nullptr;
+
+  if (bucket->counters)
+    return;
+
+  if (bucket->prev)
+    bucket->prev->next = bucket->next;
+  else
+    smallest = bucket->next;
+
+  if (bucket->next)
+    bucket->next->prev = bucket->prev;
+
+  freeBuckets.push_back(bucket);
+}
+
+template <typename Key, typename Value, typename Hash>
+void SpaceSaving<Key, Value, Hash>::moveTo(Counter *counter,
+                                           const Value &count) {
+  Bucket *prev = counter->bucket;
+  Bucket *next = prev ? prev->next : smallest;
+
+  while (next and next->count < count) {
+    this->incrementCounter(1);
+    prev = next;
+    next = next->next;
+  }
+
+  Bucket *target;
+
+  if (next) {
+    this->incrementCounter(2);
+    target = next->count == count ? next : newBucket(count, prev, next);
+  } else {
+    target = newBucket(count, prev, next);
+  }
+
+  // The new bucket is linked first: `prev` may be the counter's own bucket,
+  // which detach() releases if the counter was its last one.
+  detach(counter);
+
+  counter->bucket = target;
+  counter->next = target->counters;
+  if (target->counters)
+    target->counters->prev = counter;
+  target->counters = counter;
+}
+
+template <typename Key, typename Value, typename Hash>
+const StreamSummaryCounter<Key, Value> *
+SpaceSaving<Key, Value, Hash>::findCounter(const Key &key) const {
+  auto it = index.find(key);
+  return it == index.end() ? nullptr : it->second;
+}
+
+template <typename Key, typename Value, typename Hash>
+SpaceSaving<Key, Value, Hash>::SpaceSaving(size_t capacity)
+    : capacity(capacity), buckets(capacity + 1), smallest(nullptr),
+      totalCount(), evictionsCount(0) {
+  if (capacity == 0)
+    throw std::invalid_argument("Space-Saving requires at least one counter.");
+
+  counters.reserve(capacity);
+  index.reserve(capacity);
+  clear();
+}
+
+template <typename Key, typename Value, typename Hash>
+void SpaceSaving<Key, Value, Hash>::insert(const Key &key,
+                                           const Value &value) {
+  increment(key, value);
+}
+
+template <typename Key, typename Value, typename Hash>
+bool SpaceSaving<Key, Value, Hash>::find(const Key &key,
+                                         Value &outValue) const {
+  const Counter *counter = findCounter(key);
+
+  if (!counter)
+    return false;
+
+  outValue = counter->bucket->count;
+  return true;
+}
+
+template <typename Key, typename Value, typename Hash>
+void SpaceSaving<Key, Value, Hash>::update(const Key &, const Value &) {
+  throw UnsupportedOperationException();
+}
+
+template <typename Key, typename Value, typename Hash>
+void SpaceSaving<Key, Value, Hash>::remove(const Key &) {
+  throw UnsupportedOperationException();
+}
+
+template <typename Key, typename Value, typename Hash>
+void SpaceSaving<Key, Value, Hash>::clear() {
+  counters.clear();
+  index.clear();
+  smallest = nullptr;
+
+  freeBuckets.clear();
+  for (Bucket &bucket : buckets)
+    freeBuckets.push_back(&bucket);
+
+  totalCount = Value();
+  evictionsCount = 0;
+  this->resetCounter();
+}
+
+template <typename Key, typename Value, typename Hash>
+void SpaceSaving<Key, Value, Hash>::printInOrder(std::ostream &out) const {
+  std::vector<std::tuple<Key, Value, Value>> entries;
+  entries.reserve(counters.size());
+
+  for (const Counter &counter : counters)
+    entries.emplace_back(counter.key, counter.bucket->count, counter.error);
+
+  std::sort(entries.begin(), entries.end(),
+            [](const std::tuple<Key, Value, Value> &a,
+               const std::tuple<Key, Value, Value> &b) {
+              return std::get<0>(a) < std::get<0>(b);
+            });
+
+  size_t keyWidth = 0, countWidth = 0;
+
+  for (const auto &[key, count, error] : entries) {
+    keyWidth = std::max(keyWidth, StringHandler::size(key));
+    countWidth = std::max(countWidth, StringHandler::size(count));
+  }
+
+  for (const auto &[key, count, error] : entries)
+    out << StringHandler::SetWidthAtLeft(key, keyWidth) << " | "
+        << StringHandler::SetWidthAtLeft(count, countWidth) << " (erro ≤ "
+        << error << ")\n";
+}
+
+template <typename Key, typename Value, typename Hash>
+void SpaceSaving<Key, Value, Hash>::forEach(
+    const std::function<void(const Key &, const Value &)> &action) const {
+  for (const Counter &counter : counters)
+    action(counter.key, counter.bucket->count);
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t SpaceSaving<Key, Value, Hash>::getComparisonsCount() const {
+  return this->comparisonsCount;
+}
+
+template <typename Key, typename Value, typename Hash>
+Value &SpaceSaving<Key, Value, Hash>::operator[](const Key &) {
+  throw UnsupportedOperationException();
+}
+
+template <typename Key, typename Value, typename Hash>
+const Value &SpaceSaving<Key, Value, Hash>::operator[](const Key &key) const {
+  const Counter *counter = findCounter(key);
+
+  if (!counter)
+    throw KeyNotFoundException();
+
+  return counter->bucket->count;
+}
+
+template <typename Key, typename Value, typename Hash>
+void SpaceSaving<Key, Value, Hash>::increment(const Key &key,
+                                              const Value &amount) {
+  if (amount == Value())
+    return;
+
+  totalCount += amount;
+
+  auto it = index.find(key);
+
+  if (it != index.end()) {
+    moveTo(it->second, it->second->bucket->count + amount);
+    return;
+  }
+
+  Counter *counter;
+
+  if (counters.size() < capacity) {
+    counters.emplace_back(key);
+    counter = &counters.back();
+    moveTo(counter, amount);
+  } else {
+    // Evict a key with the smallest count; the newcomer may have occurred
+    // up to that many times unseen.
+    counter = smallest->counters;
+    index.erase(counter->key);
+    evictionsCount++;
+
+    Value minimum = smallest->count;
+    counter->key = key;
+    counter->error = minimum;
+    moveTo(counter, minimum + amount);
+  }
+
+  index.emplace(key, counter);
+}
+
+template <typename Key, typename Value, typename Hash>
+Value SpaceSaving<Key, Value, Hash>::getError(const Key &key) const {
+  const Counter *counter = findCounter(key);
+
+  if (!counter)
+    throw KeyNotFoundException();
+
+  return counter->error;
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t SpaceSaving<Key, Value, Hash>::getCapacity() const {
+  return capacity;
+}
+
+template <typename Key, typename Value, typename Hash>
+Value SpaceSaving<Key, Value, Hash>::getMinimumCount() const {
+  // Until every counter is used, unseen keys have not been evicted.
+  if (!smallest or counters.size() < capacity)
+    return Value();
+
+  return smallest->count;
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t SpaceSaving<Key, Value, Hash>::getEvictionsCount() const {
+  return evictionsCount;
+}
+
+template <typename Key, typename Value, typename Hash>
+void SpaceSaving<Key, Value, Hash>::accept(
+    IDictionaryVisitor<Key, Value> &visitor) const {
+  visitor.collectMetrics(*this);
+}
+
+template <typename Key, typename Value, typename Hash>
+size_t SpaceSaving<Key, Value, Hash>::getMemoryUsage() const {
+  // Each index entry is a hash node holding the pair, a next pointer and the
+  // cached hash code.
+  size_t indexNode =
+      sizeof(std::pair<const Key, Counter *>) + 2 * sizeof(void *);
+
+  return counters.capacity() * (sizeof(Counter) + indexNode) +
+         buckets.size() * sizeof(Bucket) +
+         freeBuckets.capacity() * sizeof(Bucket *) +
+         index.bucket_count() * sizeof(void *);
+}
@@ -0,0 +1,88 @@
+#ifndef STREAM_SUMMARY_NODES_HPP
+#define STREAM_SUMMARY_NODES_HPP
+
+template <typename Key, typename Value> struct StreamSummaryBucket;
+
+/**
+ * @brief A monitored key of the stream-summary structure.
+ *
+ * Counters with the same count hang from the same bucket, in a doubly linked
+ * list, so a counter can be moved to another bucket in constant time.
+ *
+ * @tparam Key The type of the key.
+ * @tparam Value The type of the counts.
+ */
+template <typename Key, typename Value> struct StreamSummaryCounter {
+  /**
+   * @brief The monitored key.
+   */
+  Key key;
+
+  /**
+   * @brief The most the count may exceed the true count of the key: the count
+   * of the key it replaced.
+   */
+  Value error;
+
+  /**
+   * @brief The bucket holding the count, or nullptr while detached.
+   */
+  StreamSummaryBucket<Key, Value> *bucket;
+
+  /**
+   * @brief The previous counter of the bucket.
+   */
+  StreamSummaryCounter *prev;
+
+  /**
+   * @brief The next counter of the bucket.
+   */
+  StreamSummaryCounter *next;
+
+  /**
+   * @brief Constructs a detached counter for a key.
+   *
+   * @param k The monitored key.
+   */
+  explicit StreamSummaryCounter(const Key &k)
+      : key(k), error(), bucket(nullptr), prev(nullptr), next(nullptr) {}
+};
+
+/**
+ * @brief A group of counters sharing the same count.
+ *
+ * Buckets form a doubly linked list in increasing order of count, so the
+ * smallest count, which is the one evicted, is always at its head.
+ *
+ * @tparam Key The type of the keys.
+ * @tparam Value The type of the counts.
+ */
+template <typename Key, typename Value> struct StreamSummaryBucket {
+  /**
+   * @brief The count shared by the counters of the bucket.
+   */
+  Value count;
+
+  /**
+   * @brief The first counter of the bucket.
+   */
+  StreamSummaryCounter<Key, Value> *counters;
+
+  /**
+   * @brief The bucket with the next smaller count.
+   */
+  StreamSummaryBucket *prev;
+
+  /**
+   * @brief The bucket with the next larger count.
+   */
+  StreamSummaryBucket *next;
+
+  /**
+   * @brief Constructs an empty, unlinked bucket.
+   */
+  StreamSummaryBucket()
+      : count(), counters(nullptr), prev(nullptr), next(nullptr) {}
+};
+
+#endif
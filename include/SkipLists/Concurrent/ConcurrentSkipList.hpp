@@ -0,0 +1,301 @@
+#ifndef CONCURRENT_SKIP_LIST_HPP
+#define CONCURRENT_SKIP_LIST_HPP
+
+#include <array>
+#include <atomic>
+#include <iostream>
+#include <vector>
+
+#include "Dictionary/IDictionary.hpp"
+#include "SkipLists/Concurrent/SkipListNode.hpp"
+
+/**
+ * @brief A lock-free skip list (Herlihy and Shavit) that may be shared by
+ * several threads.
+ *
+ * Insertions link a new node bottom-up with compare-and-swap on the forward
+ * pointers, and removals mark the forward pointers of the victim top-down
+ * before it is unlinked by the next traversal that meets it. increment() is a
+ * lock-free upsert followed by an atomic `fetch_add` on the value, so many
+ * threads may count words in the same list at once.
+ *
+ * Removed nodes are never freed while the list is in use. They are kept in a
+ * retired list and released by clear() or by the destructor, which must not
+ * run concurrently with any other operation.
+ *
+ * Statistics are kept per thread, in cache-line-aligned slots, so that
+ * counting them does not make the threads contend on a shared counter.
+ *
+ * @tparam Key The type of the keys.
+ * @tparam Value The type of the values. Must be an integral type for
+ * increment().
+ */
+template <typename Key, typename Value>
+class ConcurrentSkipList : public IDictionary<Key, Value> {
+public:
+  /**
+   * @brief The statistics gathered by one thread.
+   */
+  struct ThreadStatistics {
+    /**
+     * @brief Key comparisons made by the thread.
+     */
+    size_t comparisons;
+
+    /**
+     * @brief Keys inserted by the thread.
+     */
+    size_t insertions;
+
+    /**
+     * @brief Compare-and-swap operations of the thread that lost a race.
+     */
+    size_t casFailures;
+  };
+
+  /**
+   * @brief The maximum height of a node.
+   */
+  static const int MAX_LEVEL = 24;
+
+  /**
+   * @brief The maximum number of threads with separate statistics. Further
+   * threads share slots.
+   */
+  static const size_t MAX_THREADS = 64;
+
+private:
+  using Node = SkipListNode<Key, Value>;
+
+  /**
+   * @brief Per-thread counters, padded to a cache line to avoid false
+   * sharing.
+   */
+  struct alignas(64) ThreadCounters {
+    std::atomic<size_t> comparisons{0};
+    std::atomic<size_t> insertions{0};
+    std::atomic<size_t> casFailures{0};
+  };
+
+  /**
+   * @brief Sentinel node with MAX_LEVEL levels, smaller than every key.
+   */
+  Node *head;
+
+  /**
+   * @brief Removed nodes awaiting reclamation, linked by `nextRetired`.
+   */
+  std::atomic<Node *> retired;
+
+  /**
+   * @brief The number of keys currently in the list.
+   */
+  std::atomic<size_t> numberOfElements;
+
+  /**
+   * @brief The number of nodes allocated, head and retired nodes included.
+   */
+  std::atomic<size_t> nodesCount;
+
+  /**
+   * @brief The number of forward pointers allocated.
+   */
+  std::atomic<size_t> levelsCount;
+
+  /**
+   * @brief The statistics slots, indexed by threadSlot().
+   */
+  mutable std::array<ThreadCounters, MAX_THREADS> counters;
+
+  /**
+   * @brief Extracts the node pointer of a marked pointer.
+   */
+  static Node *pointerOf(uintptr_t word);
+
+  /**
+   * @brief Extracts the deletion mark of a marked pointer.
+   */
+  static bool isMarked(uintptr_t word);
+
+  /**
+   * @brief Builds a marked pointer.
+   */
+  static uintptr_t pack(Node *node, bool marked);
+
+  /**
+   * @brief Returns the statistics slot of the calling thread.
+   */
+  static size_t threadSlot();
+
+  /**
+   * @brief Draws the height of a new node from a geometric distribution with
+   * p = 1/2.
+   */
+  static int randomLevel();
+
+  /**
+   * @brief Finds the predecessors and successors of a key on every level,
+   * unlinking the marked nodes met on the way.
+   *
+   * @param key The key to look for.
+   * @param preds Receives the predecessors, one per level.
+   * @param succs Receives the successors, one per level (nullptr stands for
+   * the end of the level).
+   * @param counters The statistics slot of the calling thread.
+   * @return true if `succs[0]` holds the key; false otherwise.
+   */
+  bool locate(const Key &key, Node **preds, Node **succs,
+              ThreadCounters &counters) const;
+
+  /**
+   * @brief Returns the node of a key, inserting a new one holding `value` if
+   * the key is not present.
+   *
+   * @param key The key to look for.
+   * @param value The value of the node if it has to be inserted.
+   * @param inserted Set to true if the key was not present.
+   * @return Node* The node of the key.
+   */
+  Node *upsert(const Key &key, const Value &value, bool &inserted);
+
+  /**
+   * @brief Releases every node, retired ones included, leaving only the head.
+   */
+  void releaseNodes();
+
+public:
+  /**
+   * @brief Constructs an empty skip list.
+   */
+  ConcurrentSkipList();
+
+  ConcurrentSkipList(const ConcurrentSkipList &) = delete;
+  ConcurrentSkipList &operator=(const ConcurrentSkipList &) = delete;
+
+  /**
+   * @brief Releases every node. Must not run concurrently with other
+   * operations.
+   */
+  ~ConcurrentSkipList();
+
+  /**
+   * @brief Inserts a key-value pair. Thread-safe.
+   *
+   * @param key The key to be inserted.
+   * @param value The value associated with the key.
+   * @throws KeyAlreadyExistsException If the key is already present.
+   */
+  void insert(const Key &key, const Value &value) override;
+
+  /**
+   * @brief Searches for a key and retrieves its value if found. Thread-safe.
+   *
+   * @param key The key to search for.
+   * @param outValue Receives the value of the key, if found.
+   * @return true if the key is found; false otherwise.
+   */
+  bool find(const Key &key, Value &outValue) const override;
+
+  /**
+   * @brief Atomically replaces the value of an existing key. Thread-safe.
+   *
+   * @param key The key to be updated.
+   * @param value The new value.
+   * @throws KeyNotFoundException If the key is not present.
+   */
+  void update(const Key &key, const Value &value) override;
+
+  /**
+   * @brief Removes a key, if present. Thread-safe.
+   *
+   * @param key The key to be removed.
+   */
+  void remove(const Key &key) override;
+
+  /**
+   * @brief Removes every key and resets the statistics. Must not run
+   * concurrently with other operations.
+   */
+  void clear() override;
+
+  /**
+   * @brief Prints the key-value pairs by walking the bottom level, which is
+   * already sorted.
+   *
+   * @param out The output stream.
+   */
+  void printInOrder(std::ostream &out) const override;
+
+  /**
+   * @brief Calls a function on every key-value pair, in order of key, skipping nodes marked for removal.
+   *
+   * @param action The function called with each key and value.
+   */
+  void forEach(const std::function<void(const Key &, const Value &)> &action)
+      const override;
+
+  /**
+   * @brief Returns the key comparisons made by all threads.
+   */
+  size_t getComparisonsCount() const override;
+
+  /**
+   * @brief Returns a reference to the value of a key, inserting a
+   * default-constructed value if the key is not present.
+   *
+   * The lookup and the insertion are thread-safe, but modifying the value
+   * through the reference is not; use increment() for that.
+   *
+   * @param key The key to access.
+   * @return Value& A reference to the value.
+   */
+  Value &operator[](const Key &key) override;
+
+  /**
+   * @brief Returns a const reference to the value of a key. Thread-safe.
+   *
+   * @param key The key to access.
+   * @return const Value& A reference to the value.
+   * @throws KeyNotFoundException If the key is not present.
+   */
+  const Value &operator[](const Key &key) const override;
+
+  /**
+   * @brief Lock-free upsert followed by a relaxed atomic addition on the value.
+   *
+   * @param key The key whose value is incremented.
+   * @param amount The amount to add.
+   */
+  void increment(const Key &key, const Value &amount) override;
+
+  /**
+   * @brief Always true: the skip list supports concurrent access.
+   */
+  bool isThreadSafe() const override;
+
+  /**
+   * @brief Returns the statistics of every thread that used the list, in the
+   * order in which the threads first touched it.
+   */
+  std::vector<ThreadStatistics> getThreadStatistics() const;
+
+  /**
+   * @brief Returns the compare-and-swap failures of all threads.
+   */
+  size_t getCasFailuresCount() const;
+
+  /**
+   * @brief Accepts a visitor implementing IDictionaryVisitor interface to
+   * collect metrics or perform operations on the ConcurrentSkipList.
+   *
+   * @param visitor A reference to an IDictionaryVisitor<Key, Value> object that
+   * will interact with the ConcurrentSkipList.
+   */
+  void accept(IDictionaryVisitor<Key, Value> &visitor) const override;
+
+  size_t getMemoryUsage() const override;
+};
+
+#include "SkipLists/Concurrent/ConcurrentSkipList.impl.hpp"
+
+#endif
@@ -0,0 +1,420 @@
+#include "SkipLists/Concurrent/ConcurrentSkipList.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <thread>
+
+#include "Exceptions/KeyExceptions.hpp"
+#include "Utils/Strings/StringHandler.hpp"
+
+template <typename Key, typename Value>
+typename ConcurrentSkipList<Key, Value>::Node *
+ConcurrentSkipList<Key, Value>::pointerOf(uintptr_t word) {
+  return reinterpret_cast<Node *>(word & ~static_cast<uintptr_t>(1));
+}
+
+template <typename Key, typename Value>
+bool ConcurrentSkipList<Key, Value>::isMarked(uintptr_t word) {
+  return word & 1;
+}
+
+template <typename Key, typename Value>
+uintptr_t ConcurrentSkipList<Key, Value>::pack(Node *node, bool marked) {
+  return reinterpret_cast<uintptr_t>(node) | static_cast<uintptr_t>(marked);
+}
+
+template <typename Key, typename Value>
+size_t ConcurrentSkipList<Key, Value>::threadSlot() {
+  static std::atomic<size_t> nextSlot{0};
+  thread_local size_t slot =
+      nextSlot.fetch_add(1, std::memory_order_relaxed) % MAX_THREADS;
+  return slot;
+}
+
+template <typename Key, typename Value>
+int ConcurrentSkipList<Key, Value>::randomLevel() {
+  thread_local std::mt19937_64 generator(
+      std::random_device{}() ^
+      std::hash<std::thread::id>{}(std::this_thread::get_id()));
+
+  uint64_t bits = generator();
+  int level = 1;
+
+  while (level < MAX_LEVEL and (bits & 1)) {
+    level++;
+    bits >>= 1;
+  }
+
+  return level;
+}
+
+template <typename Key, typename Value>
+bool ConcurrentSkipList<Key, Value>::locate(const Key &key, Node **preds,
+                                            Node **succs,
+                                            ThreadCounters &stats) const {
+  size_t comparisons = 0;
+
+  while (true) {
+    bool restart = false;
+    Node *pred = head, *curr = nullptr;
+
+    for (int level = MAX_LEVEL - 1; level >= 0 and !restart; level--) {
+      curr = pointerOf(pred->next[level].load(std::memory_order_acquire));
+
+      while (curr) {
+        uintptr_t succWord = curr->next[level].load(std::memory_order_acquire);
+        Node *succ = pointerOf(succWord);
+
+        if (isMarked(succWord)) {
+          uintptr_t expected = pack(curr, false);
+
+          if (!pred->next[level].compare_exchange_strong(
+                  expected, pack(succ, false), std::memory_order_acq_rel)) {
+            stats.casFailures.fetch_add(1, std::memory_order_relaxed);
+            restart = true;
+            break;
+          }
+
+          curr = succ;
+          continue;
+        }
+
+        comparisons++;
+        if (!(curr->key < key))
+          break;
+
+        pred = curr;
+        curr = succ;
+      }
+
+      preds[level] = pred;
+      succs[level] = curr;
+    }
+
+    if (restart)
+      continue;
+
+    bool found = false;
+    if (curr) {
+      comparisons++;
+      found = curr->key == key;
+    }
+
+    stats.comparisons.fetch_add(comparisons, std::memory_order_relaxed);
+    return found;
+  }
+}
+
+template <typename Key, typename Value>
+typename ConcurrentSkipList<Key, Value>::Node *
+ConcurrentSkipList<Key, Value>::upsert(const Key &key, const Value &value,
+                                       bool &inserted) {
+  ThreadCounters &stats = counters[threadSlot()];
+  Node *preds[MAX_LEVEL], *succs[MAX_LEVEL];
+  Node *node = nullptr;
+
+  while (true) {
+    if (locate(key, preds, succs, stats)) {
+      delete node;
+      inserted = false;
+      return succs[0];
+    }
+
+    if (!node)
+      node = new Node(key, value, randomLevel());
+
+    for (int level = 0; level < node->topLevel; level++)
+      node->next[level].store(pack(succs[level], false),
+                              std::memory_order_relaxed);
+
+    uintptr_t expected = pack(succs[0], false);
+    if (preds[0]->next[0].compare_exchange_strong(expected, pack(node, false),
+                                                  std::memory_order_acq_rel))
+      break;
+
+    stats.casFailures.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  // The node is now in the list; the upper levels are only shortcuts.
+  bool abandoned = false;
+
+  for (int level = 1; level < node->topLevel and !abandoned; level++) {
+    while (true) {
+      uintptr_t expected = pack(succs[level], false);
+
+      if (preds[level]->next[level].compare_exchange_strong(
+              expected, pack(node, false), std::memory_order_acq_rel))
+        break;
+
+      stats.casFailures.fetch_add(1, std::memory_order_relaxed);
+      locate(key, preds, succs, stats);
+
+      uintptr_t current = node->next[level].load(std::memory_order_acquire);
+
+      // A concurrent remove() already started marking the node.
+      if (isMarked(current) or
+          !node->next[level].compare_exchange_strong(
+              current, pack(succs[level], false), std::memory_order_acq_rel)) {
+        abandoned = true;
+        break;
+      }
+    }
+  }
+
+  numberOfElements.fetch_add(1, std::memory_order_relaxed);
+  nodesCount.fetch_add(1, std::memory_order_relaxed);
+  levelsCount.fetch_add(node->topLevel, std::memory_order_relaxed);
+  stats.insertions.fetch_add(1, std::memory_order_relaxed);
+
+  inserted = true;
+  return node;
+}
+
+template <typename Key, typename Value>
+void ConcurrentSkipList<Key, Value>::releaseNodes() {
+  Node *node = pointerOf(head->next[0].load(std::memory_order_relaxed));
+
+  while (node) {
+    uintptr_t nextWord = node->next[0].load(std::memory_order_relaxed);
+
+    // Marked nodes are reclaimed from the retired list below.
+    if (!isMarked(nextWord))
+      delete node;
+
+    node = pointerOf(nextWord);
+  }
+
+  node = retired.exchange(nullptr);
+
+  while (node) {
+    Node *next = node->nextRetired;
+    delete node;
+    node = next;
+  }
+
+  for (int level = 0; level < MAX_LEVEL; level++)
+    head->next[level].store(0, std::memory_order_relaxed);
+}
+
+template <typename Key, typename Value>
+ConcurrentSkipList<Key, Value>::ConcurrentSkipList()
+    : head(new Node(Key(), Value(), MAX_LEVEL)), retired(nullptr),
+      numberOfElements(0), nodesCount(1), levelsCount(MAX_LEVEL) {}
+
+template <typename Key, typename Value>
+ConcurrentSkipList<Key, Value>::~ConcurrentSkipList() {
+  releaseNodes();
+  delete head;
+}
+
+template <typename Key, typename Value>
+void ConcurrentSkipList<Key, Value>::insert(const Key &key,
+                                            const Value &value) {
+  bool inserted;
+  upsert(key, value, inserted);
+
+  if (!inserted)
+    throw KeyAlreadyExistsException();
+}
+
+template <typename Key, typename Value>
+bool ConcurrentSkipList<Key, Value>::find(const Key &key,
+                                          Value &outValue) const {
+  Node *preds[MAX_LEVEL], *succs[MAX_LEVEL];
+
+  if (!locate(key, preds, succs, counters[threadSlot()]))
+    return false;
+
+  outValue = __atomic_load_n(&succs[0]->value, __ATOMIC_RELAXED);
+  return true;
+}
+
+template <typename Key, typename Value>
+void ConcurrentSkipList<Key, Value>::update(const Key &key,
+                                            const Value &value) {
+  Node *preds[MAX_LEVEL], *succs[MAX_LEVEL];
+
+  if (!locate(key, preds, succs, counters[threadSlot()]))
+    throw KeyNotFoundException();
+
+  __atomic_store_n(&succs[0]->value, value, __ATOMIC_RELAXED);
+}
+
+template <typename Key, typename Value>
+void ConcurrentSkipList<Key, Value>::remove(const Key &key) {
+  ThreadCounters &stats = counters[threadSlot()];
+  Node *preds[MAX_LEVEL], *succs[MAX_LEVEL];
+
+  if (!locate(key, preds, succs, stats))
+    return;
+
+  Node *victim = succs[0];
+
+  for (int level = victim->topLevel - 1; level > 0; level--) {
+    uintptr_t succ = victim->next[level].load(std::memory_order_acquire);
+
+    while (!isMarked(succ)) {
+      if (!victim->next[level].compare_exchange_weak(
+              succ, succ | 1, std::memory_order_acq_rel))
+        stats.casFailures.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  uintptr_t succ = victim->next[0].load(std::memory_order_acquire);
+
+  while (!isMarked(succ)) {
+    if (victim->next[0].compare_exchange_strong(succ, succ | 1,
+                                                std::memory_order_acq_rel)) {
+      // This thread owns the removal: unlink the node and retire it.
+      locate(key, preds, succs, stats);
+
+      Node *top = retired.load(std::memory_order_relaxed);
+      do {
+        victim->nextRetired = top;
+      } while (!retired.compare_exchange_weak(top, victim,
+                                              std::memory_order_release,
+                                              std::memory_order_relaxed));
+
+      numberOfElements.fetch_sub(1, std::memory_order_relaxed);
+      return;
+    }
+
+    stats.casFailures.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+template <typename Key, typename Value>
+void ConcurrentSkipList<Key, Value>::clear() {
+  releaseNodes();
+
+  numberOfElements = 0;
+  nodesCount = 1;
+  levelsCount = MAX_LEVEL;
+
+  for (ThreadCounters &slot : counters) {
+    slot.comparisons = 0;
+    slot.insertions = 0;
+    slot.casFailures = 0;
+  }
+}
+
+template <typename Key, typename Value>
+void ConcurrentSkipList<Key, Value>::printInOrder(std::ostream &out) const {
+  size_t maxKeyLen = 0, maxValLen = 0;
+
+  for (int pass = 0; pass < 2; pass++) {
+    uintptr_t word = head->next[0].load(std::memory_order_acquire);
+
+    while (pointerOf(word)) {
+      const Node *node = pointerOf(word);
+      word = node->next[0].load(std::memory_order_acquire);
+
+      if (isMarked(word))
+        continue;
+
+      if (pass == 0) {
+        maxKeyLen = std::max(maxKeyLen, StringHandler::size(node->key));
+        maxValLen = std::max(maxValLen, StringHandler::size(node->value));
+      } else {
+        out << StringHandler::SetWidthAtLeft(node->key, maxKeyLen) << " | "
+            << StringHandler::SetWidthAtLeft(node->value, maxValLen) << "\n";
+      }
+    }
+  }
+}
+
+template <typename Key, typename Value>
+void ConcurrentSkipList<Key, Value>::forEach(
+    const std::function<void(const Key &, const Value &)> &action) const {
+  uintptr_t word = head->next[0].load(std::memory_order_acquire);
+
+  while (pointerOf(word)) {
+    const Node *node = pointerOf(word);
+    word = node->next[0].load(std::memory_order_acquire);
+
+    if (!isMarked(word))
+      action(node->key, node->value);
+  }
+}
+
+template <typename Key, typename Value>
+size_t ConcurrentSkipList<Key, Value>::getComparisonsCount() const {
+  size_t total = 0;
+
+  for (const ThreadCounters &slot : counters)
+    total += slot.comparisons.load(std::memory_order_relaxed);
+
+  return total;
+}
+
+template <typename Key, typename Value>
+Value &ConcurrentSkipList<Key, Value>::operator[](const Key &key) {
+  bool inserted;
+  return upsert(key, Value(), inserted)->value;
+}
+
+template <typename Key, typename Value>
+const Value &ConcurrentSkipList<Key, Value>::operator[](const Key &key) const {
+  Node *preds[MAX_LEVEL], *succs[MAX_LEVEL];
+
+  if (!locate(key, preds, succs, counters[threadSlot()]))
+    throw KeyNotFoundException();
+
+  return succs[0]->value;
+}
+
+template <typename Key, typename Value>
+void ConcurrentSkipList<Key, Value>::increment(const Key &key,
+                                               const Value &amount) {
+  bool inserted;
+  Node *node = upsert(key, Value(), inserted);
+  __atomic_fetch_add(&node->value, amount, __ATOMIC_RELAXED);
+}
+
+template <typename Key, typename Value>
+bool ConcurrentSkipList<Key, Value>::isThreadSafe() const {
+  return true;
+}
+
+template <typename Key, typename Value>
+std::vector<typename ConcurrentSkipList<Key, Value>::ThreadStatistics>
+ConcurrentSkipList<Key, Value>::getThreadStatistics() const {
+  std::vector<ThreadStatistics> statistics;
+
+  for (const ThreadCounters &slot : counters) {
+    ThreadStatistics entry = {
+        slot.comparisons.load(std::memory_order_relaxed),
+        slot.insertions.load(std::memory_order_relaxed),
+        slot.casFailures.load(std::memory_order_relaxed)};
+
+    if (entry.comparisons or entry.insertions or entry.casFailures)
+      statistics.push_back(entry);
+  }
+
+  return statistics;
+}
+
+template <typename Key, typename Value>
+size_t ConcurrentSkipList<Key, Value>::getCasFailuresCount() const {
+  size_t total = 0;
+
+  for (const ThreadCounters &slot : counters)
+    total += slot.casFailures.load(std::memory_order_relaxed);
+
+  return total;
+}
+
+template <typename Key, typename Value>
+void ConcurrentSkipList<Key, Value>::accept(
+    IDictionaryVisitor<Key, Value> &visitor) const {
+  visitor.collectMetrics(*this);
+}
+
+template <typename Key, typename Value>
+size_t ConcurrentSkipList<Key, Value>::getMemoryUsage() const {
+  return sizeof(*this) +
+         nodesCount.load(std::memory_order_relaxed) * sizeof(Node) +
+         levelsCount.load(std::memory_order_relaxed) *
+             sizeof(std::atomic<uintptr_t>);
+}
@@ -0,0 +1,68 @@
+#ifndef SKIP_LIST_NODE_HPP
+#define SKIP_LIST_NODE_HPP
+
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @brief Node of a lock-free skip list.
+ *
+ * The forward pointers are stored as `uintptr_t` words whose lowest bit is the
+ * deletion mark of the node that owns them (Harris' marked pointers): a node is
+ * logically removed from a level once its forward pointer at that level is
+ * marked, and it is physically unlinked by the next traversal that finds it.
+ *
+ * @tparam Key The type of the key.
+ * @tparam Value The type of the value.
+ */
+template <typename Key, typename Value> struct SkipListNode {
+  /**
+   * @brief The key of the node. Immutable once the node is published.
+   */
+  Key key;
+
+  /**
+   * @brief The value of the node. Concurrent updates go through the
+   * `__atomic` builtins.
+   */
+  Value value;
+
+  /**
+   * @brief The number of levels the node is linked on.
+   */
+  int topLevel;
+
+  /**
+   * @brief The marked forward pointers, one per level.
+   */
+  std::atomic<uintptr_t> *next;
+
+  /**
+   * @brief Link used by the list of removed nodes awaiting reclamation.
+   */
+  SkipListNode *nextRetired;
+
+  /**
+   * @brief Constructs an unlinked node.
+   *
+   * @param k The key of the node.
+   * @param v The initial value of the node.
+   * @param levels The number of levels of the node.
+   */
+  SkipListNode(const Key &k, const Value &v, int levels)
+      : key(k), value(v), topLevel(levels),
+        next(new std::atomic<uintptr_t>[levels]), nextRetired(nullptr) {
+    for (int i = 0; i < levels; i++)
+      next[i].store(0, std::memory_order_relaxed);
+  }
+
+  SkipListNode(const SkipListNode &) = delete;
+  SkipListNode &operator=(const SkipListNode &) = delete;
+
+  /**
+   * @brief Releases the forward pointers.
+   */
+  ~SkipListNode() { delete[] next; }
+};
+
+#endif
@@ -151,6 +151,57 @@ private:
   AVLNode<Key, Value> *upsert(const Key &key, AVLNode<Key, Value> *node,
                               Value *&outValue);
 
+  /**
+   * @brief Copies a subtree, heights included.
+   *
+   * @param node The root of the subtree to copy.
+   * @return A pointer to the root of the copy.
+   */
+  static AVLNode<Key, Value> *clone(const AVLNode<Key, Value> *node);
+
+  /**
+   * @brief Joins two AVL trees around a middle node whose key lies between
+   * theirs.
+   *
+   * Descends the spine of the taller tree down to a subtree about as tall as
+   * the shorter one, hangs the middle node there and rebalances on the way
+   * back up, in O(|height(less) - height(greater)| + 1).
+   *
+   * @param less A tree whose keys are all smaller than the middle key.
+   * @param middle The middle node; its children are overwritten.
+   * @param greater A tree whose keys are all greater than the middle key.
+   * @return A pointer to the root of the joined tree.
+   */
+  AVLNode<Key, Value> *join(AVLNode<Key, Value> *less,
+                            AVLNode<Key, Value> *middle,
+                            AVLNode<Key, Value> *greater);
+
+  /**
+   * @brief Splits a tree by a key into the keys smaller and greater than it.
+   *
+   * @param node The root of the tree to split; its nodes are reused.
+   * @param key The key to split by.
+   * @param less Receives the tree of the smaller keys.
+   * @param equal Receives the node holding `key`, or nullptr.
+   * @param greater Receives the tree of the greater keys.
+   */
+  void split(AVLNode<Key, Value> *node, const Key &key,
+             AVLNode<Key, Value> *&less, AVLNode<Key, Value> *&equal,
+             AVLNode<Key, Value> *&greater);
+
+  /**
+   * @brief Merges two trees, adding the values of the keys present in both.
+   *
+   * Splits `b` by the root key of `a`, unites the halves with the subtrees
+   * of `a` and joins the results, in O(m log(n/m + 1)) for trees of sizes
+   * m <= n.
+   *
+   * @param a The root of the first tree; its nodes are reused.
+   * @param b The root of the second tree; its nodes are reused or freed.
+   * @return A pointer to the root of the merged tree.
+   */
+  AVLNode<Key, Value> *unite(AVLNode<Key, Value> *a, AVLNode<Key, Value> *b);
+
 public:
   static const int IMBALANCE = 2; ///< The imbalance threshold for the AVL tree.
 
@@ -214,6 +265,14 @@ public:
    */
   void printInOrder(std::ostream &out) const override;
 
+  /**
+   * @brief Calls a function on every key-value pair, in order of key.
+   *
+   * @param action The function called with each key and value.
+   */
+  void forEach(const std::function<void(const Key &, const Value &)> &action)
+      const override;
+
   /**
    * @brief Retrieves the count of comparisons made during operations on the AVL
    * tree.
@@ -238,6 +297,30 @@ public:
    */
   const Value &operator[](const Key &key) const override;
 
+  /**
+   * @brief Adds an amount to the value of a key, inserting the key with a
+   * default value first if needed.
+   *
+   * Unlike going through operator[], the width of the resulting value is
+   * recorded, so the printed table stays aligned when values grow by more
+   * than one at a time.
+   *
+   * @param key The key whose value is incremented.
+   * @param amount The amount to add.
+   */
+  void increment(const Key &key, const Value &amount) override;
+
+  /**
+   * @brief Adds every key-value pair of another dictionary to this tree.
+   *
+   * When `other` is also an AVLTree, a copy of it is united with this tree
+   * by splits and joins (see unite()), which is much cheaper than inserting
+   * its keys one by one when the trees overlap a lot or differ much in size.
+   *
+   * @param other The dictionary to merge from.
+   */
+  void mergeFrom(const IDictionary<Key, Value> &other) override;
+
   /**
    * @brief Prints the AVL tree structure.
    */
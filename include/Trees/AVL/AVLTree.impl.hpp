@@ -202,6 +202,94 @@ AVLNode<Key, Value> *AVLTree<Key, Value>::upsert(const Key &key,
   return fixupNode(node);
 }
 
+template <typename Key, typename Value>
+AVLNode<Key, Value> *
+AVLTree<Key, Value>::clone(const AVLNode<Key, Value> *node) {
+  if (!node)
+    return nullptr;
+
+  AVLNode<Key, Value> *copy =
+      new AVLNode<Key, Value>(node->getKey(), node->getValue());
+  copy->left = clone(node->left);
+  copy->right = clone(node->right);
+  copy->height = node->height;
+
+  return copy;
+}
+
+template <typename Key, typename Value>
+AVLNode<Key, Value> *AVLTree<Key, Value>::join(AVLNode<Key, Value> *less,
+                                               AVLNode<Key, Value> *middle,
+                                               AVLNode<Key, Value> *greater) {
+  if (height(less) > height(greater) + 1) {
+    less->right = join(less->right, middle, greater);
+    return fixupNode(less);
+  }
+
+  if (height(greater) > height(less) + 1) {
+    greater->left = join(less, middle, greater->left);
+    return fixupNode(greater);
+  }
+
+  middle->left = less;
+  middle->right = greater;
+  middle->height = calcHeight(middle);
+
+  return middle;
+}
+
+template <typename Key, typename Value>
+void AVLTree<Key, Value>::split(AVLNode<Key, Value> *node, const Key &key,
+                                AVLNode<Key, Value> *&less,
+                                AVLNode<Key, Value> *&equal,
+                                AVLNode<Key, Value> *&greater) {
+  if (!node) {
+    less = equal = greater = nullptr;
+    return;
+  }
+
+  AVLNode<Key, Value> *left = node->left, *right = node->right;
+
+  if (key < node->getKey()) {
+    this->incrementCounter(1);
+    split(left, key, less, equal, greater);
+    greater = join(greater, node, right);
+  } else if (key > node->getKey()) {
+    this->incrementCounter(2);
+    split(right, key, less, equal, greater);
+    less = join(left, node, less);
+  } else {
+    this->incrementCounter(2);
+    less = left;
+    greater = right;
+    equal = node;
+  }
+}
+
+template <typename Key, typename Value>
+AVLNode<Key, Value> *AVLTree<Key, Value>::unite(AVLNode<Key, Value> *a,
+                                                AVLNode<Key, Value> *b) {
+  if (!a)
+    return b;
+  if (!b)
+    return a;
+
+  AVLNode<Key, Value> *less, *equal, *greater;
+  split(b, a->getKey(), less, equal, greater);
+
+  if (equal) {
+    a->getValue() += equal->getValue();
+    this->setMaxValLen(a->getValue());
+    delete equal;
+  }
+
+  // Both recursive calls read a's children, so join() must come last.
+  AVLNode<Key, Value> *left = unite(a->left, less),
+                      *right = unite(a->right, greater);
+
+  return join(left, a, right);
+}
+
 template <typename Key, typename Value>
 AVLTree<Key, Value>::AVLTree()
     : BaseTree<AVLTree<Key, Value>, AVLNode<Key, Value>, Key, Value>(nullptr) {}
@@ -267,6 +355,12 @@ void AVLTree<Key, Value>::printInOrder(std::ostream &os) const {
   this->inOrderTransversal(os, this->root, nullptr);
 }
 
+template <typename Key, typename Value>
+void AVLTree<Key, Value>::forEach(
+    const std::function<void(const Key &, const Value &)> &action) const {
+  this->forEachNode(action, nullptr);
+}
+
 template <typename Key, typename Value>
 size_t AVLTree<Key, Value>::getComparisonsCount() const {
   return this->comparisonsCount;
@@ -284,6 +378,30 @@ const Value &AVLTree<Key, Value>::operator[](const Key &key) const {
   return this->at(key);
 }
 
+template <typename Key, typename Value>
+void AVLTree<Key, Value>::increment(const Key &key, const Value &amount) {
+  Value &value = (*this)[key];
+  value += amount;
+  this->setMaxValLen(value);
+}
+
+template <typename Key, typename Value>
+void AVLTree<Key, Value>::mergeFrom(const IDictionary<Key, Value> &other) {
+  const AVLTree<Key, Value> *tree =
+      dynamic_cast<const AVLTree<Key, Value> *>(&other);
+
+  if (!tree) {
+    IDictionary<Key, Value>::mergeFrom(other);
+    return;
+  }
+
+  AVLNode<Key, Value> *copy = clone(tree->root);
+
+  this->maxKeyLen = std::max(this->maxKeyLen, tree->maxKeyLen);
+  this->maxValLen = std::max(this->maxValLen, tree->maxValLen);
+  this->root = unite(this->root, copy);
+}
+
 template <typename Key, typename Value>
 size_t AVLTree<Key, Value>::getRotationsCount() const {
   return this->rotationsCount;
@@ -1,6 +1,7 @@
 #ifndef BASE_TREE_HPP
 #define BASE_TREE_HPP
 
+#include <functional>
 #include <iostream>
 
 #include "Exceptions/KeyExceptions.hpp"
@@ -129,6 +130,17 @@ protected:
    */
   void inOrderTransversal(std::ostream &out, Node *node, Node *comp) const;
 
+  /**
+   * @brief Calls a function on every node of the tree, in order.
+   *
+   * The traversal is iterative, so degenerate trees do not exhaust the stack.
+   *
+   * @param action The function called with each key and value.
+   * @param comp A comparison node (e.g., a sentinel node to stop traversal).
+   */
+  void forEachNode(const std::function<void(const Key &, const Value &)> &action,
+                   Node *comp) const;
+
   /**
    * @brief Accesses the value associated with a given key.
    * @param key The key whose associated value is to be returned.
@@ -4,6 +4,7 @@
 #include "Trees/Base/BaseTree.hpp"
 
 #include <cmath>
+#include <vector>
 
 #include "Utils/Strings/StringHandler.hpp"
 
@@ -85,6 +86,26 @@ void BaseTree<Tree, Node, Key, Value>::inOrderTransversal(std::ostream &out,
   }
 }
 
+template <typename Tree, typename Node, typename Key, typename Value>
+void BaseTree<Tree, Node, Key, Value>::forEachNode(
+    const std::function<void(const Key &, const Value &)> &action,
+    Node *comp) const {
+  std::vector<const Node *> stack;
+  const Node *node = root;
+
+  while (node != comp or !stack.empty()) {
+    while (node != comp) {
+      stack.push_back(node);
+      node = node->left;
+    }
+
+    node = stack.back();
+    stack.pop_back();
+    action(node->getKey(), node->getValue());
+    node = node->right;
+  }
+}
+
 template <typename Tree, typename Node, typename Key, typename Value>
 const Value &BaseTree<Tree, Node, Key, Value>::at(const Key &key,
                                                   Node *comp) const {
@@ -3,6 +3,7 @@
 
 #include <functional>
 #include <iostream>
+#include <vector>
 
 #include "Dictionary/IDictionary.hpp"
 #include "Trees/Base/BaseTree.hpp"
@@ -93,6 +94,27 @@ private:
    */
   void printTree(RedBlackNode<Key, Value>* node, const std::string& prefix, bool isLeft) const;
 
+  /**
+   * @brief Builds a balanced Red-Black Tree out of nodes sorted by key.
+   *
+   * The middle node becomes the root and each half becomes a subtree, so
+   * every level but the deepest is full. The nodes of the deepest level,
+   * `redDepth`, are colored red and all others black, which gives every
+   * path the same number of black nodes.
+   *
+   * @param nodes The nodes, sorted by key; their links are overwritten.
+   * @param begin The first node of the subtree.
+   * @param end One past the last node of the subtree.
+   * @param depth The depth of the subtree's root.
+   * @param redDepth The depth whose nodes are red.
+   * @param parent The parent of the subtree's root.
+   * @return A pointer to the root of the subtree, or NIL if it is empty.
+   */
+  static RedBlackNode<Key, Value> *
+  build(const std::vector<RedBlackNode<Key, Value> *> &nodes, size_t begin,
+        size_t end, size_t depth, size_t redDepth,
+        RedBlackNode<Key, Value> *parent);
+
 public:
   /**
    * @brief Constructs an empty Red-Black Tree.
@@ -147,6 +169,14 @@ public:
    */
   void printInOrder(std::ostream &out) const;
 
+  /**
+   * @brief Calls a function on every key-value pair, in order of key.
+   *
+   * @param action The function called with each key and value.
+   */
+  virtual void
+  forEach(const std::function<void(const Key &, const Value &)> &action) const;
+
   /**
    * @brief Retrieves the count of comparisons made during operations on the
    * Red-Black Tree.
@@ -171,6 +201,31 @@ public:
    */
   virtual const Value &operator[](const Key &key) const;
 
+  /**
+   * @brief Adds an amount to the value of a key, inserting the key with a
+   * default value first if needed.
+   *
+   * Unlike going through operator[], the width of the resulting value is
+   * recorded, so the printed table stays aligned when values grow by more
+   * than one at a time.
+   *
+   * @param key The key whose value is incremented.
+   * @param amount The amount to add.
+   */
+  virtual void increment(const Key &key, const Value &amount);
+
+  /**
+   * @brief Adds every key-value pair of another dictionary to this tree.
+   *
+   * When `other` is also a RedBlackTree, the two in-order sequences are
+   * merged in one linear pass, reusing the nodes of this tree, and the tree
+   * is rebuilt balanced from the result in O(n + m), instead of inserting
+   * the m keys one by one in O(m log(n + m)).
+   *
+   * @param other The dictionary to merge from.
+   */
+  virtual void mergeFrom(const IDictionary<Key, Value> &other);
+
   /**
    * @brief Prints the structure of the Red-Black Tree.
    */
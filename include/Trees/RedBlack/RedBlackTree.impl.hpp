@@ -93,6 +93,25 @@ template <typename Key, typename Value>
 RedBlackNode<Key, Value> RedBlackTree<Key, Value>::NIL_NODE =
     RedBlackNode<Key, Value>();
 
+template <typename Key, typename Value>
+RedBlackNode<Key, Value> *RedBlackTree<Key, Value>::build(
+    const std::vector<RedBlackNode<Key, Value> *> &nodes, size_t begin,
+    size_t end, size_t depth, size_t redDepth,
+    RedBlackNode<Key, Value> *parent) {
+  if (begin == end)
+    return NIL;
+
+  size_t middle = begin + (end - begin) / 2;
+  RedBlackNode<Key, Value> *node = nodes[middle];
+
+  node->parent = parent;
+  node->color = depth == redDepth ? RED : BLACK;
+  node->left = build(nodes, begin, middle, depth + 1, redDepth, node);
+  node->right = build(nodes, middle + 1, end, depth + 1, redDepth, node);
+
+  return node;
+}
+
 template <typename Key, typename Value>
 RedBlackTree<Key, Value>::RedBlackTree()
     : BaseTree<RedBlackTree<Key, Value>, RedBlackNode<Key, Value>, Key, Value>(
@@ -333,6 +352,12 @@ void RedBlackTree<Key, Value>::printInOrder(std::ostream &os) const {
   this->inOrderTransversal(os, this->root, NIL);
 }
 
+template <typename Key, typename Value>
+void RedBlackTree<Key, Value>::forEach(
+    const std::function<void(const Key &, const Value &)> &action) const {
+  this->forEachNode(action, NIL);
+}
+
 template <typename Key, typename Value>
 size_t RedBlackTree<Key, Value>::getComparisonsCount() const {
   return this->comparisonsCount;
@@ -387,6 +412,69 @@ const Value &RedBlackTree<Key, Value>::operator[](const Key &key) const {
   return this->at(key);
 }
 
+template <typename Key, typename Value>
+void RedBlackTree<Key, Value>::increment(const Key &key, const Value &amount) {
+  Value &value = (*this)[key];
+  value += amount;
+  this->setMaxValLen(value);
+}
+
+template <typename Key, typename Value>
+void RedBlackTree<Key, Value>::mergeFrom(const IDictionary<Key, Value> &other) {
+  const RedBlackTree<Key, Value> *tree =
+      dynamic_cast<const RedBlackTree<Key, Value> *>(&other);
+
+  if (!tree or tree == this) {
+    IDictionary<Key, Value>::mergeFrom(other);
+    return;
+  }
+
+  std::vector<RedBlackNode<Key, Value> *> own, merged;
+  std::vector<RedBlackNode<Key, Value> *> stack;
+
+  for (RedBlackNode<Key, Value> *node = this->root;
+       node != NIL or !stack.empty();) {
+    for (; node != NIL; node = node->left)
+      stack.push_back(node);
+
+    node = stack.back();
+    stack.pop_back();
+    own.push_back(node);
+    node = node->right;
+  }
+
+  size_t i = 0;
+
+  tree->forEach([&](const Key &key, const Value &value) {
+    while (i < own.size() and own[i]->getKey() < key) {
+      this->incrementCounter(1);
+      merged.push_back(own[i++]);
+    }
+
+    if (i < own.size() and !(key < own[i]->getKey())) {
+      this->incrementCounter(2);
+      own[i]->getValue() += value;
+      this->setMaxValLen(own[i]->getValue());
+      merged.push_back(own[i++]);
+    } else {
+      merged.push_back(
+          new RedBlackNode<Key, Value>(key, value, NIL, NIL, NIL, RED));
+    }
+  });
+
+  merged.insert(merged.end(), own.begin() + i, own.end());
+
+  this->maxKeyLen = std::max(this->maxKeyLen, tree->maxKeyLen);
+  this->maxValLen = std::max(this->maxValLen, tree->maxValLen);
+
+  // Every level above depth floor(log2(n + 1)) is full.
+  size_t redDepth = 0;
+  while ((size_t(2) << redDepth) <= merged.size() + 1)
+    redDepth++;
+
+  this->root = build(merged, 0, merged.size(), 0, redDepth, NIL);
+}
+
 template <typename Key, typename Value>
 size_t RedBlackTree<Key, Value>::getRotationsCount() const {
   return this->rotationsCount;
@@ -0,0 +1,37 @@
+#ifndef SPLAY_NODE_HPP
+#define SPLAY_NODE_HPP
+
+#include "Trees/Base/Node.hpp"
+
+/**
+ * @brief Splay tree node structure extending a generic Node.
+ *
+ * A splay tree keeps no balance information, so the node only adds the child
+ * pointers to the key-value pair.
+ *
+ * @tparam Key The type of the key.
+ * @tparam Value The type of the value.
+ */
+template <typename Key, typename Value>
+struct SplayNode : public Node<Key, Value> {
+  /**
+   * @brief Pointer to the left child.
+   */
+  SplayNode *left;
+
+  /**
+   * @brief Pointer to the right child.
+   */
+  SplayNode *right;
+
+  /**
+   * @brief Constructs a leaf node with the given key and value.
+   *
+   * @param k The key associated with the node.
+   * @param v The value associated with the node.
+   */
+  SplayNode(const Key &k, const Value &v)
+      : Node<Key, Value>(k, v), left(nullptr), right(nullptr) {}
+};
+
+#endif
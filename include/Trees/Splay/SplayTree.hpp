@@ -0,0 +1,171 @@
+#ifndef SPLAY_TREE_HPP
+#define SPLAY_TREE_HPP
+
+#include <iostream>
+
+#include "Dictionary/IDictionary.hpp"
+#include "Trees/Base/BaseTree.hpp"
+#include "Trees/Splay/SplayNode.hpp"
+
+/**
+ * @brief A self-adjusting binary search tree (Sleator and Tarjan).
+ *
+ * Every access through operator[], insert(), update() and remove() splays the
+ * accessed key to the root using the top-down splaying algorithm, which walks
+ * down the tree only once and needs neither recursion nor parent pointers.
+ * Frequently accessed keys, such as the most common words of a text, therefore
+ * stay close to the root without storing any balance information in the nodes.
+ *
+ * Since the tree may temporarily degenerate into a long path, the traversals
+ * of this class (printing, clearing) are iterative as well.
+ *
+ * @tparam Key The type of the keys stored in the tree.
+ * @tparam Value The type of the values associated with the keys.
+ */
+template <typename Key, typename Value>
+class SplayTree : public IDictionary<Key, Value>,
+                  public BaseTree<SplayTree<Key, Value>, SplayNode<Key, Value>,
+                                  Key, Value> {
+private:
+  /**
+   * @brief The number of nodes of the tree.
+   */
+  size_t nodesCount;
+
+  /**
+   * @brief Splays the node of a key (or the last node on its search path) to
+   * the root of a subtree, top-down.
+   *
+   * @param key The key to be splayed.
+   * @param node The root of the subtree.
+   * @return SplayNode<Key, Value>* The new root of the subtree.
+   */
+  SplayNode<Key, Value> *splay(const Key &key, SplayNode<Key, Value> *node);
+
+  /**
+   * @brief Splays a key and, if it is not present, makes a new node holding
+   * `value` the root.
+   *
+   * @param key The key to look for.
+   * @param value The value of the new node.
+   * @return true if a new node was created; false if the key was present.
+   */
+  bool splayOrInsert(const Key &key, const Value &value);
+
+public:
+  /**
+   * @brief Constructs an empty splay tree.
+   */
+  SplayTree();
+
+  /**
+   * @brief Destroys the tree, releasing every node.
+   */
+  ~SplayTree();
+
+  /**
+   * @brief Inserts a key-value pair and splays it to the root.
+   *
+   * @param key The key to insert.
+   * @param value The value associated with the key.
+   * @throws KeyAlreadyExistsException If the key is already present.
+   */
+  void insert(const Key &key, const Value &value) override;
+
+  /**
+   * @brief Searches for a key and retrieves its value.
+   *
+   * The search is const and therefore does not splay.
+   *
+   * @param key The key to search for.
+   * @param outValue Receives the value of the key, if found.
+   * @return true if the key is found; false otherwise.
+   */
+  bool find(const Key &key, Value &outValue) const override;
+
+  /**
+   * @brief Updates the value associated with a key and splays it to the root.
+   *
+   * @param key The key to update.
+   * @param value The new value.
+   * @throws KeyNotFoundException If the key is not found in the tree.
+   */
+  void update(const Key &key, const Value &value) override;
+
+  /**
+   * @brief Removes a key from the tree, if present.
+   *
+   * @param key The key to be removed.
+   */
+  void remove(const Key &key) override;
+
+  /**
+   * @brief Clears the tree by deallocating all nodes.
+   */
+  void clear() override;
+
+  /**
+   * @brief Prints the elements of the tree with an iterative in-order
+   * traversal.
+   *
+   * @param out The output stream where the traversal result will be written.
+   */
+  void printInOrder(std::ostream &out) const override;
+
+  /**
+   * @brief Calls a function on every key-value pair, in order of key, without splaying.
+   *
+   * @param action The function called with each key and value.
+   */
+  void forEach(const std::function<void(const Key &, const Value &)> &action)
+      const override;
+
+  /**
+   * @brief Retrieves the count of comparisons made during operations on the
+   * tree.
+   *
+   * @return The total number of comparisons made.
+   */
+  size_t getComparisonsCount() const override;
+
+  /**
+   * @brief Accesses the value associated with a key, inserting a
+   * default-constructed value if needed, and splays the key to the root.
+   *
+   * @param key The key to access.
+   * @return A reference to the associated value.
+   */
+  Value &operator[](const Key &key) override;
+
+  /**
+   * @brief Accesses the value associated with a key (const version, does not
+   * splay).
+   *
+   * @param key The key to access.
+   * @return A const reference to the associated value.
+   * @throws KeyNotFoundException If the key is not found in the tree.
+   */
+  const Value &operator[](const Key &key) const override;
+
+  /**
+   * @brief Retrieves the total number of rotations performed while splaying.
+   *
+   * @return size_t The total number of rotations performed.
+   */
+  size_t getRotationsCount() const;
+
+  /**
+   * @brief Accepts a visitor implementing IDictionaryVisitor interface to
+   * collect metrics or perform operations on the SplayTree.
+   *
+   * @param visitor A reference to an IDictionaryVisitor<Key, Value> object that
+   * will interact with the SplayTree.
+   */
+  void accept(IDictionaryVisitor<Key, Value> &visitor) const override;
+
+  size_t getMemoryUsage() const override;
+};
+
+#include "Trees/Splay/SplayTree.impl.hpp"
+
+#endif
@@ -0,0 +1,258 @@
+#include "Trees/Splay/SplayTree.hpp"
+
+#include <vector>
+
+#include "Utils/Strings/StringHandler.hpp"
+
+template <typename Key, typename Value>
+SplayNode<Key, Value> *
+SplayTree<Key, Value>::splay(const Key &key, SplayNode<Key, Value> *node) {
+  if (!node)
+    return nullptr;
+
+  // The header collects the left tree in its `right` pointer and the right
+  // tree in its `left` pointer; `leftMax` and `rightMin` are their ends.
+  SplayNode<Key, Value> header{Key(), Value()};
+  SplayNode<Key, Value> *leftMax = &header, *rightMin = &header;
+
+  while (true) {
+    if (key < node->getKey()) {
+      this->incrementCounter(1);
+      if (!node->left)
+        break;
+
+      this->incrementCounter(1);
+      if (key < node->left->getKey()) {
+        // Zig-zig: rotate right before linking.
+        SplayNode<Key, Value> *child = node->left;
+        node->left = child->right;
+        child->right = node;
+        node = child;
+        this->incrementRotationsCount();
+
+        if (!node->left)
+          break;
+      }
+
+      rightMin->left = node;
+      rightMin = node;
+      node = node->left;
+    } else if (key > node->getKey()) {
+      this->incrementCounter(2);
+      if (!node->right)
+        break;
+
+      this->incrementCounter(1);
+      if (key > node->right->getKey()) {
+        // Zag-zag: rotate left before linking.
+        SplayNode<Key, Value> *child = node->right;
+        node->right = child->left;
+        child->left = node;
+        node = child;
+        this->incrementRotationsCount();
+
+        if (!node->right)
+          break;
+      }
+
+      leftMax->right = node;
+      leftMax = node;
+      node = node->right;
+    } else {
+      this->incrementCounter(2);
+      break;
+    }
+  }
+
+  leftMax->right = node->left;
+  rightMin->left = node->right;
+  node->left = header.right;
+  node->right = header.left;
+
+  return node;
+}
+
+template <typename Key, typename Value>
+bool SplayTree<Key, Value>::splayOrInsert(const Key &key, const Value &value) {
+  if (!this->root) {
+    this->root = new SplayNode<Key, Value>(key, value);
+    nodesCount++;
+    return true;
+  }
+
+  this->root = splay(key, this->root);
+
+  SplayNode<Key, Value> *newNode;
+
+  if (key < this->root->getKey()) {
+    this->incrementCounter(1);
+    newNode = new SplayNode<Key, Value>(key, value);
+    newNode->left = this->root->left;
+    newNode->right = this->root;
+    this->root->left = nullptr;
+  } else if (key > this->root->getKey()) {
+    this->incrementCounter(2);
+    newNode = new SplayNode<Key, Value>(key, value);
+    newNode->right = this->root->right;
+    newNode->left = this->root;
+    this->root->right = nullptr;
+  } else {
+    this->incrementCounter(2);
+    return false;
+  }
+
+  this->root = newNode;
+  nodesCount++;
+  return true;
+}
+
+template <typename Key, typename Value>
+SplayTree<Key, Value>::SplayTree()
+    : BaseTree<SplayTree<Key, Value>, SplayNode<Key, Value>, Key, Value>(
+          nullptr),
+      nodesCount(0) {}
+
+template <typename Key, typename Value> SplayTree<Key, Value>::~SplayTree() {
+  clear();
+}
+
+template <typename Key, typename Value>
+void SplayTree<Key, Value>::insert(const Key &key, const Value &value) {
+  if (!splayOrInsert(key, value))
+    throw KeyAlreadyExistsException();
+}
+
+template <typename Key, typename Value>
+bool SplayTree<Key, Value>::find(const Key &key, Value &outValue) const {
+  const SplayNode<Key, Value> *node = this->findNode(key);
+
+  if (!node)
+    return false;
+
+  outValue = node->getValue();
+  return true;
+}
+
+template <typename Key, typename Value>
+void SplayTree<Key, Value>::update(const Key &key, const Value &value) {
+  this->root = splay(key, this->root);
+
+  if (!this->root or key != this->root->getKey())
+    throw KeyNotFoundException();
+
+  this->root->setValue(value);
+}
+
+template <typename Key, typename Value>
+void SplayTree<Key, Value>::remove(const Key &key) {
+  this->root = splay(key, this->root);
+
+  if (!this->root or key != this->root->getKey())
+    return;
+
+  SplayNode<Key, Value> *removed = this->root;
+
+  if (!removed->left) {
+    this->root = removed->right;
+  } else {
+    // Every key of the left subtree is smaller than `key`, so splaying it
+    // brings its maximum to the top, leaving the right child free.
+    this->root = splay(key, removed->left);
+    this->root->right = removed->right;
+  }
+
+  delete removed;
+  nodesCount--;
+}
+
+template <typename Key, typename Value> void SplayTree<Key, Value>::clear() {
+  SplayNode<Key, Value> *node = this->root;
+
+  // Rotates left children up until the node has none, then frees it; this
+  // visits every node without recursion or an auxiliary stack.
+  while (node) {
+    if (node->left) {
+      SplayNode<Key, Value> *child = node->left;
+      node->left = child->right;
+      child->right = node;
+      node = child;
+    } else {
+      SplayNode<Key, Value> *next = node->right;
+      delete node;
+      node = next;
+    }
+  }
+
+  this->reset(nullptr);
+  nodesCount = 0;
+}
+
+template <typename Key, typename Value>
+void SplayTree<Key, Value>::printInOrder(std::ostream &out) const {
+  std::vector<const SplayNode<Key, Value> *> nodes;
+  std::vector<const SplayNode<Key, Value> *> stack;
+  nodes.reserve(nodesCount);
+
+  const SplayNode<Key, Value> *node = this->root;
+
+  while (node or !stack.empty()) {
+    while (node) {
+      stack.push_back(node);
+      node = node->left;
+    }
+
+    node = stack.back();
+    stack.pop_back();
+    nodes.push_back(node);
+    node = node->right;
+  }
+
+  size_t keyWidth = 0, valueWidth = 0;
+
+  for (const SplayNode<Key, Value> *n : nodes) {
+    keyWidth = std::max(keyWidth, StringHandler::size(n->getKey()));
+    valueWidth = std::max(valueWidth, StringHandler::size(n->getValue()));
+  }
+
+  for (const SplayNode<Key, Value> *n : nodes)
+    out << StringHandler::SetWidthAtLeft(n->getKey(), keyWidth) << " | "
+        << StringHandler::SetWidthAtLeft(n->getValue(), valueWidth) << '\n';
+}
+
+template <typename Key, typename Value>
+void SplayTree<Key, Value>::forEach(
+    const std::function<void(const Key &, const Value &)> &action) const {
+  this->forEachNode(action, nullptr);
+}
+
+template <typename Key, typename Value>
+size_t SplayTree<Key, Value>::getComparisonsCount() const {
+  return this->comparisonsCount;
+}
+
+template <typename Key, typename Value>
+Value &SplayTree<Key, Value>::operator[](const Key &key) {
+  splayOrInsert(key, Value());
+  return this->root->getValue();
+}
+
+template <typename Key, typename Value>
+const Value &SplayTree<Key, Value>::operator[](const Key &key) const {
+  return this->at(key);
+}
+
+template <typename Key, typename Value>
+size_t SplayTree<Key, Value>::getRotationsCount() const {
+  return this->rotationsCount;
+}
+
+template <typename Key, typename Value>
+void SplayTree<Key, Value>::accept(
+    IDictionaryVisitor<Key, Value> &visitor) const {
+  visitor.collectMetrics(*this);
+}
+
+template <typename Key, typename Value>
+size_t SplayTree<Key, Value>::getMemoryUsage() const {
+  return nodesCount * sizeof(SplayNode<Key, Value>);
+}
@@ -0,0 +1,331 @@
+#ifndef TREAP_HPP
+#define TREAP_HPP
+
+#include <iostream>
+#include <random>
+
+#include "Dictionary/IDictionary.hpp"
+#include "Trees/Base/BaseTree.hpp"
+#include "Trees/Treap/TreapNode.hpp"
+
+/**
+ * @brief A randomized binary search tree (Seidel and Aragon).
+ *
+ * Each node draws a random priority and the tree is kept heap-ordered by it,
+ * which gives an expected height of O(log n) whatever the insertion order.
+ * Besides the dictionary operations, a treap can be split by a key and two
+ * treaps with disjoint key ranges can be joined, both in expected O(log n).
+ *
+ * unite() builds on them to merge two treaps in O(m log(n/m + 1)) expected
+ * work, where m <= n are their sizes, summing the values of the keys present
+ * in both. The two halves of each recursive step are independent, so the
+ * top levels of the recursion run on separate threads. This is meant for
+ * merging partial word counts built by several threads.
+ *
+ * Priorities come from a generator with a fixed seed, so runs over the same
+ * input build the same tree.
+ *
+ * @tparam Key The type of the keys stored in the tree.
+ * @tparam Value The type of the values associated with the keys. Must support
+ * `+=` for unite().
+ */
+template <typename Key, typename Value>
+class Treap : public IDictionary<Key, Value>,
+              public BaseTree<Treap<Key, Value>, TreapNode<Key, Value>, Key,
+                              Value> {
+private:
+  /**
+   * @brief Generator of the node priorities, seeded by each treap from
+   * std::random_device, so that treaps built side by side draw independent
+   * priorities and the shape changes from run to run.
+   */
+  std::mt19937 priorities;
+
+  /**
+   * @brief Performs a left rotation on a given node.
+   *
+   * @param y The node to be rotated.
+   * @return A pointer to the new root of the subtree after the rotation.
+   */
+  TreapNode<Key, Value> *rotateLeft(TreapNode<Key, Value> *y);
+
+  /**
+   * @brief Performs a right rotation on a given node.
+   *
+   * @param y The node to be rotated.
+   * @return A pointer to the new root of the subtree after the rotation.
+   */
+  TreapNode<Key, Value> *rotateRight(TreapNode<Key, Value> *y);
+
+  /**
+   * @brief Looks for a key in a subtree, inserting a new node holding `value`
+   * if it is absent, and restores the heap order on the way back up.
+   *
+   * @param key The key to look for.
+   * @param value The value of the new node.
+   * @param node The root of the subtree.
+   * @param outValue Receives a pointer to the value of the key.
+   * @param inserted Set to true if a new node was created.
+   * @return TreapNode<Key, Value>* The new root of the subtree.
+   */
+  TreapNode<Key, Value> *upsert(const Key &key, const Value &value,
+                                TreapNode<Key, Value> *node, Value *&outValue,
+                                bool &inserted);
+
+  /**
+   * @brief Removes a key from a subtree by joining the children of its node.
+   *
+   * @param key The key to be removed.
+   * @param node The root of the subtree.
+   * @return TreapNode<Key, Value>* The new root of the subtree.
+   */
+  TreapNode<Key, Value> *remove(const Key &key, TreapNode<Key, Value> *node);
+
+  /**
+   * @brief Splits a subtree into the keys smaller and greater than a key,
+   * detaching the node of the key itself, if present.
+   *
+   * It touches no member of the treap, so it may run on several threads at
+   * once on disjoint subtrees.
+   *
+   * @param node The root of the subtree.
+   * @param key The key to split by.
+   * @param less Receives the subtree of the keys smaller than `key`.
+   * @param greater Receives the subtree of the keys greater than `key`.
+   * @param equal Receives the node of `key`, or nullptr.
+   * @param comparisons Incremented by the key comparisons made.
+   */
+  static void split(TreapNode<Key, Value> *node, const Key &key,
+                    TreapNode<Key, Value> *&less,
+                    TreapNode<Key, Value> *&greater,
+                    TreapNode<Key, Value> *&equal, size_t &comparisons);
+
+  /**
+   * @brief Joins two subtrees whose keys are all smaller in the first one.
+   *
+   * @param less The subtree of the smaller keys.
+   * @param greater The subtree of the greater keys.
+   * @return TreapNode<Key, Value>* The root of the joined subtree.
+   */
+  static TreapNode<Key, Value> *join(TreapNode<Key, Value> *less,
+                                     TreapNode<Key, Value> *greater);
+
+  /**
+   * @brief Merges two subtrees, summing the values of the common keys.
+   *
+   * The root with the higher priority stays on top and the other subtree is
+   * split by its key; the two sides are then united recursively, on a new
+   * thread for the right side while `parallelDepth` is positive.
+   *
+   * @param a The root of one subtree.
+   * @param b The root of the other subtree.
+   * @param parallelDepth Levels of the recursion that still fork a thread.
+   * @param comparisons Incremented by the key comparisons made.
+   * @return TreapNode<Key, Value>* The root of the merged subtree.
+   */
+  static TreapNode<Key, Value> *unite(TreapNode<Key, Value> *a,
+                                      TreapNode<Key, Value> *b,
+                                      size_t parallelDepth,
+                                      size_t &comparisons);
+
+  /**
+   * @brief Copies a subtree, priorities included, so that the copy is still
+   * heap-ordered.
+   *
+   * @param node The root of the subtree to copy.
+   * @return TreapNode<Key, Value>* The root of the copy.
+   */
+  static TreapNode<Key, Value> *clone(const TreapNode<Key, Value> *node);
+
+  /**
+   * @brief Returns the node with the greatest key of a non-empty subtree.
+   */
+  static const TreapNode<Key, Value> *maximum(const TreapNode<Key, Value> *n);
+
+  /**
+   * @brief Measures the widest key and value of a subtree, for printing.
+   */
+  static void measure(const TreapNode<Key, Value> *node, size_t &keyWidth,
+                      size_t &valueWidth);
+
+  /**
+   * @brief Prints a subtree in order with the given column widths.
+   */
+  static void print(std::ostream &out, const TreapNode<Key, Value> *node,
+                    size_t keyWidth, size_t valueWidth);
+
+public:
+  /**
+   * @brief Constructs an empty treap.
+   */
+  Treap();
+
+  Treap(const Treap &) = delete;
+  Treap &operator=(const Treap &) = delete;
+
+  /**
+   * @brief Destroys the treap, releasing every node.
+   */
+  ~Treap();
+
+  /**
+   * @brief Inserts a key-value pair into the treap.
+   *
+   * @param key The key to insert.
+   * @param value The value associated with the key.
+   * @throws KeyAlreadyExistsException If the key is already present.
+   */
+  void insert(const Key &key, const Value &value) override;
+
+  /**
+   * @brief Searches for a key and retrieves its value if found.
+   *
+   * @param key The key to search for.
+   * @param outValue Receives the value of the key, if found.
+   * @return true if the key is found; false otherwise.
+   */
+  bool find(const Key &key, Value &outValue) const override;
+
+  /**
+   * @brief Updates the value associated with a key.
+   *
+   * @param key The key to update.
+   * @param value The new value.
+   * @throws KeyNotFoundException If the key is not found in the treap.
+   */
+  void update(const Key &key, const Value &value) override;
+
+  /**
+   * @brief Removes a key from the treap, if present.
+   *
+   * @param key The key to be removed.
+   */
+  void remove(const Key &key) override;
+
+  /**
+   * @brief Clears the treap by deallocating all nodes.
+   */
+  void clear() override;
+
+  /**
+   * @brief Prints the elements of the treap with an in-order traversal.
+   *
+   * @param out The output stream where the traversal result will be written.
+   */
+  void printInOrder(std::ostream &out) const override;
+
+  /**
+   * @brief Calls a function on every key-value pair, in order of key.
+   *
+   * @param action The function called with each key and value.
+   */
+  void forEach(const std::function<void(const Key &, const Value &)> &action)
+      const override;
+
+  /**
+   * @brief Retrieves the count of comparisons made during operations on the
+   * treap.
+   *
+   * @return The total number of comparisons made.
+   */
+  size_t getComparisonsCount() const override;
+
+  /**
+   * @brief Accesses the value associated with a key, inserting a
+   * default-constructed value if the key is not present.
+   *
+   * @param key The key to access.
+   * @return A reference to the associated value.
+   */
+  Value &operator[](const Key &key) override;
+
+  /**
+   * @brief Accesses the value associated with a key (const version).
+   *
+   * @param key The key to access.
+   * @return A const reference to the associated value.
+   * @throws KeyNotFoundException If the key is not found in the treap.
+   */
+  const Value &operator[](const Key &key) const override;
+
+  /**
+   * @brief Moves every node of this treap into two others, split by a key.
+   *
+   * This treap is left empty. Both targets are cleared first and must be
+   * distinct from this treap.
+   *
+   * @param key The key to split by.
+   * @param less Receives the keys smaller than `key`.
+   * @param greater Receives `key` and the keys greater than it.
+   */
+  void split(const Key &key, Treap &less, Treap &greater);
+
+  /**
+   * @brief Appends the nodes of another treap, whose keys must all be greater
+   * than the keys of this one. The other treap is left empty.
+   *
+   * @param greater The treap with the greater keys.
+   * @throws KeyOrderException If the key ranges of the treaps overlap.
+   */
+  void join(Treap &greater);
+
+  /**
+   * @brief Moves every node of another treap into this one, summing the
+   * values of the keys present in both. The other treap is left empty.
+   *
+   * @param other The treap to be merged; must be distinct from this treap.
+   * @param parallelDepth Levels of the recursion that fork a thread, so up to
+   * 2^parallelDepth threads run at once. Defaults to enough levels to use
+   * every hardware thread.
+   */
+  void unite(Treap &other, size_t parallelDepth = defaultParallelDepth());
+
+  /**
+   * @brief Adds every key-value pair of another dictionary to this treap.
+   *
+   * When `other` is also a Treap, a copy of it is merged in with unite(),
+   * on a single thread; otherwise every pair is incremented in turn.
+   *
+   * @param other The dictionary to merge from.
+   */
+  void mergeFrom(const IDictionary<Key, Value> &other) override;
+
+  /**
+   * @brief Moves every key-value pair of another dictionary into this treap.
+   *
+   * When `other` is another Treap, its nodes are spliced in by unite() with
+   * defaultParallelDepth(), without copying, and `other` is left empty.
+   * Otherwise this is the const overload.
+   *
+   * @param other The dictionary to merge from.
+   */
+  void mergeFrom(IDictionary<Key, Value> &&other) override;
+
+  /**
+   * @brief Returns the smallest recursion depth at which unite() has forked
+   * one thread per hardware thread.
+   */
+  static size_t defaultParallelDepth();
+
+  /**
+   * @brief Retrieves the total number of rotations performed on insertions.
+   *
+   * @return size_t The total number of rotations performed.
+   */
+  size_t getRotationsCount() const;
+
+  /**
+   * @brief Accepts a visitor implementing IDictionaryVisitor interface to
+   * collect metrics or perform operations on the Treap.
+   *
+   * @param visitor A reference to an IDictionaryVisitor<Key, Value> object that
+   * will interact with the Treap.
+   */
+  void accept(IDictionaryVisitor<Key, Value> &visitor) const override;
+
+  size_t getMemoryUsage() const override;
+};
+
+#include "Trees/Treap/Treap.impl.hpp"
+
+#endif
@@ -0,0 +1,406 @@
+#include "Trees/Treap/Treap.hpp"
+
+#include <future>
+#include <thread>
+
+#include "Exceptions/KeyExceptions.hpp"
+#include "Utils/Strings/StringHandler.hpp"
+
+template <typename Key, typename Value>
+TreapNode<Key, Value> *
+Treap<Key, Value>::rotateLeft(TreapNode<Key, Value> *y) {
+  TreapNode<Key, Value> *x = y->right;
+
+  y->right = x->left;
+  x->left = y;
+
+  this->incrementRotationsCount();
+
+  return x;
+}
+
+template <typename Key, typename Value>
+TreapNode<Key, Value> *
+Treap<Key, Value>::rotateRight(TreapNode<Key, Value> *y) {
+  TreapNode<Key, Value> *x = y->left;
+
+  y->left = x->right;
+  x->right = y;
+
+  this->incrementRotationsCount();
+
+  return x;
+}
+
+template <typename Key, typename Value>
+TreapNode<Key, Value> *
+Treap<Key, Value>::upsert(const Key &key, const Value &value,
+                          TreapNode<Key, Value> *node, Value *&outValue,
+                          bool &inserted) {
+  if (!node) {
+    TreapNode<Key, Value> *newNode =
+        new TreapNode<Key, Value>(key, value, priorities());
+    outValue = &(newNode->getValue());
+    inserted = true;
+    return newNode;
+  }
+
+  if (key < node->getKey()) {
+    this->incrementCounter(1);
+    node->left = upsert(key, value, node->left, outValue, inserted);
+
+    if (node->left->priority > node->priority)
+      node = rotateRight(node);
+  } else if (key > node->getKey()) {
+    this->incrementCounter(2);
+    node->right = upsert(key, value, node->right, outValue, inserted);
+
+    if (node->right->priority > node->priority)
+      node = rotateLeft(node);
+  } else {
+    this->incrementCounter(2);
+    outValue = &(node->getValue());
+    inserted = false;
+  }
+
+  return node;
+}
+
+template <typename Key, typename Value>
+TreapNode<Key, Value> *Treap<Key, Value>::remove(const Key &key,
+                                                 TreapNode<Key, Value> *node) {
+  if (!node)
+    return nullptr;
+
+  if (key < node->getKey()) {
+    this->incrementCounter(1);
+    node->left = remove(key, node->left);
+  } else if (key > node->getKey()) {
+    this->incrementCounter(2);
+    node->right = remove(key, node->right);
+  } else {
+    this->incrementCounter(2);
+    TreapNode<Key, Value> *joined = join(node->left, node->right);
+    delete node;
+    return joined;
+  }
+
+  return node;
+}
+
+template <typename Key, typename Value>
+void Treap<Key, Value>::split(TreapNode<Key, Value> *node, const Key &key,
+                              TreapNode<Key, Value> *&less,
+                              TreapNode<Key, Value> *&greater,
+                              TreapNode<Key, Value> *&equal,
+                              size_t &comparisons) {
+  if (!node) {
+    less = greater = equal = nullptr;
+    return;
+  }
+
+  if (key < node->getKey()) {
+    comparisons += 1;
+    split(node->left, key, less, node->left, equal, comparisons);
+    greater = node;
+  } else if (key > node->getKey()) {
+    comparisons += 2;
+    split(node->right, key, node->right, greater, equal, comparisons);
+    less = node;
+  } else {
+    comparisons += 2;
+    less = node->left;
+    greater = node->right;
+    equal = node;
+    node->left = node->right = nullptr;
+  }
+}
+
+template <typename Key, typename Value>
+TreapNode<Key, Value> *Treap<Key, Value>::join(TreapNode<Key, Value> *less,
+                                               TreapNode<Key, Value> *greater) {
+  if (!less)
+    return greater;
+  if (!greater)
+    return less;
+
+  if (less->priority > greater->priority) {
+    less->right = join(less->right, greater);
+    return less;
+  }
+
+  greater->left = join(less, greater->left);
+  return greater;
+}
+
+template <typename Key, typename Value>
+TreapNode<Key, Value> *Treap<Key, Value>::unite(TreapNode<Key, Value> *a,
+                                                TreapNode<Key, Value> *b,
+                                                size_t parallelDepth,
+                                                size_t &comparisons) {
+  if (!a)
+    return b;
+  if (!b)
+    return a;
+
+  if (a->priority < b->priority)
+    std::swap(a, b);
+
+  TreapNode<Key, Value> *less, *greater, *equal;
+  split(b, a->getKey(), less, greater, equal, comparisons);
+
+  if (equal) {
+    a->getValue() += equal->getValue();
+    delete equal;
+  }
+
+  if (parallelDepth > 0) {
+    size_t rightComparisons = 0;
+    std::future<TreapNode<Key, Value> *> right =
+        std::async(std::launch::async, [&] {
+          return unite(a->right, greater, parallelDepth - 1, rightComparisons);
+        });
+
+    // The task reads a->right, so the left side must not overwrite it.
+    TreapNode<Key, Value> *left =
+        unite(a->left, less, parallelDepth - 1, comparisons);
+    a->right = right.get();
+    a->left = left;
+    comparisons += rightComparisons;
+  } else {
+    a->left = unite(a->left, less, 0, comparisons);
+    a->right = unite(a->right, greater, 0, comparisons);
+  }
+
+  return a;
+}
+
+template <typename Key, typename Value>
+TreapNode<Key, Value> *
+Treap<Key, Value>::clone(const TreapNode<Key, Value> *node) {
+  if (!node)
+    return nullptr;
+
+  TreapNode<Key, Value> *copy = new TreapNode<Key, Value>(
+      node->getKey(), node->getValue(), node->priority);
+  copy->left = clone(node->left);
+  copy->right = clone(node->right);
+
+  return copy;
+}
+
+template <typename Key, typename Value>
+const TreapNode<Key, Value> *
+Treap<Key, Value>::maximum(const TreapNode<Key, Value> *n) {
+  while (n->right)
+    n = n->right;
+  return n;
+}
+
+template <typename Key, typename Value>
+void Treap<Key, Value>::measure(const TreapNode<Key, Value> *node,
+                                size_t &keyWidth, size_t &valueWidth) {
+  if (!node)
+    return;
+
+  keyWidth = std::max(keyWidth, StringHandler::size(node->getKey()));
+  valueWidth = std::max(valueWidth, StringHandler::size(node->getValue()));
+  measure(node->left, keyWidth, valueWidth);
+  measure(node->right, keyWidth, valueWidth);
+}
+
+template <typename Key, typename Value>
+void Treap<Key, Value>::print(std::ostream &out,
+                              const TreapNode<Key, Value> *node,
+                              size_t keyWidth, size_t valueWidth) {
+  if (!node)
+    return;
+
+  print(out, node->left, keyWidth, valueWidth);
+  out << StringHandler::SetWidthAtLeft(node->getKey(), keyWidth) << " | "
+      << StringHandler::SetWidthAtLeft(node->getValue(), valueWidth) << '\n';
+  print(out, node->right, keyWidth, valueWidth);
+}
+
+template <typename Key, typename Value>
+Treap<Key, Value>::Treap()
+    : BaseTree<Treap<Key, Value>, TreapNode<Key, Value>, Key, Value>(nullptr),
+      priorities(std::random_device{}()) {}
+
+template <typename Key, typename Value> Treap<Key, Value>::~Treap() {
+  clear();
+}
+
+template <typename Key, typename Value>
+void Treap<Key, Value>::insert(const Key &key, const Value &value) {
+  Value *outValue = nullptr;
+  bool inserted = false;
+  this->root = upsert(key, value, this->root, outValue, inserted);
+
+  if (!inserted)
+    throw KeyAlreadyExistsException();
+}
+
+template <typename Key, typename Value>
+bool Treap<Key, Value>::find(const Key &key, Value &outValue) const {
+  const TreapNode<Key, Value> *node = this->findNode(key);
+
+  if (!node)
+    return false;
+
+  outValue = node->getValue();
+  return true;
+}
+
+template <typename Key, typename Value>
+void Treap<Key, Value>::update(const Key &key, const Value &value) {
+  TreapNode<Key, Value> *node = this->root;
+
+  while (node) {
+    if (key < node->getKey()) {
+      this->incrementCounter(1);
+      node = node->left;
+    } else if (key > node->getKey()) {
+      this->incrementCounter(2);
+      node = node->right;
+    } else {
+      this->incrementCounter(2);
+      node->setValue(value);
+      return;
+    }
+  }
+
+  throw KeyNotFoundException();
+}
+
+template <typename Key, typename Value>
+void Treap<Key, Value>::remove(const Key &key) {
+  this->root = remove(key, this->root);
+}
+
+template <typename Key, typename Value> void Treap<Key, Value>::clear() {
+  this->reset(this->root);
+}
+
+template <typename Key, typename Value>
+void Treap<Key, Value>::printInOrder(std::ostream &out) const {
+  size_t keyWidth = 0, valueWidth = 0;
+  measure(this->root, keyWidth, valueWidth);
+  print(out, this->root, keyWidth, valueWidth);
+}
+
+template <typename Key, typename Value>
+void Treap<Key, Value>::forEach(
+    const std::function<void(const Key &, const Value &)> &action) const {
+  this->forEachNode(action, nullptr);
+}
+
+template <typename Key, typename Value>
+size_t Treap<Key, Value>::getComparisonsCount() const {
+  return this->comparisonsCount;
+}
+
+template <typename Key, typename Value>
+Value &Treap<Key, Value>::operator[](const Key &key) {
+  Value *outValue = nullptr;
+  bool inserted = false;
+  this->root = upsert(key, Value(), this->root, outValue, inserted);
+  return *outValue;
+}
+
+template <typename Key, typename Value>
+const Value &Treap<Key, Value>::operator[](const Key &key) const {
+  return this->at(key);
+}
+
+template <typename Key, typename Value>
+void Treap<Key, Value>::split(const Key &key, Treap &less, Treap &greater) {
+  less.clear();
+  greater.clear();
+
+  TreapNode<Key, Value> *equal;
+  size_t comparisons = 0;
+  split(this->root, key, less.root, greater.root, equal, comparisons);
+  this->incrementCounter(comparisons);
+
+  // The node of `key` is smaller than every other key of `greater`.
+  greater.root = join(equal, greater.root);
+  this->root = nullptr;
+}
+
+template <typename Key, typename Value>
+void Treap<Key, Value>::join(Treap &greater) {
+  if (this->root and greater.root) {
+    this->incrementCounter(1);
+    if (!(maximum(this->root)->getKey() <
+          this->minimum(greater.root)->getKey()))
+      throw KeyOrderException();
+  }
+
+  this->root = join(this->root, greater.root);
+  greater.root = nullptr;
+  greater.clear();
+}
+
+template <typename Key, typename Value>
+void Treap<Key, Value>::unite(Treap &other, size_t parallelDepth) {
+  size_t comparisons = 0;
+  this->root = unite(this->root, other.root, parallelDepth, comparisons);
+  this->incrementCounter(comparisons);
+
+  other.root = nullptr;
+  other.clear();
+}
+
+template <typename Key, typename Value>
+void Treap<Key, Value>::mergeFrom(const IDictionary<Key, Value> &other) {
+  const Treap<Key, Value> *treap =
+      dynamic_cast<const Treap<Key, Value> *>(&other);
+
+  if (!treap) {
+    IDictionary<Key, Value>::mergeFrom(other);
+    return;
+  }
+
+  size_t comparisons = 0;
+  this->root = unite(this->root, clone(treap->root), 0, comparisons);
+  this->incrementCounter(comparisons);
+}
+
+template <typename Key, typename Value>
+void Treap<Key, Value>::mergeFrom(IDictionary<Key, Value> &&other) {
+  Treap<Key, Value> *treap = dynamic_cast<Treap<Key, Value> *>(&other);
+
+  if (!treap or treap == this) {
+    mergeFrom(static_cast<const IDictionary<Key, Value> &>(other));
+    return;
+  }
+
+  unite(*treap, defaultParallelDepth());
+}
+
+template <typename Key, typename Value>
+size_t Treap<Key, Value>::defaultParallelDepth() {
+  size_t depth = 0;
+
+  for (size_t threads = std::thread::hardware_concurrency(); threads > 1;
+       threads = (threads + 1) / 2)
+    depth++;
+
+  return depth;
+}
+
+template <typename Key, typename Value>
+size_t Treap<Key, Value>::getRotationsCount() const {
+  return this->rotationsCount;
+}
+
+template <typename Key, typename Value>
+void Treap<Key, Value>::accept(IDictionaryVisitor<Key, Value> &visitor) const {
+  visitor.collectMetrics(*this);
+}
+
+template <typename Key, typename Value>
+size_t Treap<Key, Value>::getMemoryUsage() const {
+  return this->sizeOf();
+}
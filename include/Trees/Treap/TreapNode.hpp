@@ -0,0 +1,46 @@
+#ifndef TREAP_NODE_HPP
+#define TREAP_NODE_HPP
+
+#include <cstdint>
+
+#include "Trees/Base/Node.hpp"
+
+/**
+ * @brief Treap node structure extending a generic Node.
+ *
+ * Besides the key order of a binary search tree, the nodes of a treap are
+ * heap-ordered by a random priority: no node has a higher priority than its
+ * parent.
+ *
+ * @tparam Key The type of the key.
+ * @tparam Value The type of the value.
+ */
+template <typename Key, typename Value>
+struct TreapNode : public Node<Key, Value> {
+  /**
+   * @brief Pointer to the left child.
+   */
+  TreapNode *left;
+
+  /**
+   * @brief Pointer to the right child.
+   */
+  TreapNode *right;
+
+  /**
+   * @brief Random heap priority of the node.
+   */
+  uint32_t priority;
+
+  /**
+   * @brief Constructs a leaf node with the given key, value and priority.
+   *
+   * @param k The key associated with the node.
+   * @param v The value associated with the node.
+   * @param p The heap priority of the node.
+   */
+  TreapNode(const Key &k, const Value &v, uint32_t p)
+      : Node<Key, Value>(k, v), left(nullptr), right(nullptr), priority(p) {}
+};
+
+#endif
@@ -0,0 +1,187 @@
+#ifndef ARRAY_HASH_HPP
+#define ARRAY_HASH_HPP
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief Cache-conscious hash container used as the leaves of a HAT-trie.
+ *
+ * Instead of allocating one node per key, every bucket is a single contiguous
+ * block of bytes in which the entries are laid out one after the other. Each
+ * entry holds the length of the key suffix, the suffix characters and the index
+ * of its value in the `values` array:
+ *
+ * @code
+ * [used bytes (uint32)][len][chars...][value index (uint32)][len][chars...]...
+ * @endcode
+ *
+ * Lengths smaller than 255 take a single byte; longer ones are stored as the
+ * marker byte 255 followed by a 32-bit length. Blocks are reallocated with an
+ * exact fit on every insertion, so the container never holds slack memory.
+ *
+ * @tparam Value The type of the values stored in the container.
+ */
+template <typename Value> class ArrayHash {
+  /**
+   * @brief The bucket array. A null pointer represents an empty bucket.
+   */
+  std::vector<char *> buckets;
+
+  /**
+   * @brief The values of the stored keys, referenced by index from the
+   * entries.
+   */
+  std::vector<Value> values;
+
+  /**
+   * @brief Indices of `values` released by removals, reused on insertion.
+   */
+  std::vector<uint32_t> freeValues;
+
+  /**
+   * @brief The number of keys currently stored in the container.
+   */
+  size_t numberOfElements;
+
+  /**
+   * @brief The total number of bytes allocated for the bucket blocks.
+   */
+  size_t allocatedBytes;
+
+  /**
+   * @brief Computes the bucket index of a key suffix.
+   *
+   * @param suffix The key suffix.
+   * @return size_t The index of the bucket where the suffix lives.
+   */
+  size_t bucketOf(std::string_view suffix) const;
+
+  /**
+   * @brief Decodes the length prefix of an entry.
+   *
+   * @param entry Pointer to the first byte of the entry.
+   * @param headerSize Receives the number of bytes used by the length prefix.
+   * @return size_t The length of the suffix stored in the entry.
+   */
+  static size_t readLength(const char *entry, size_t &headerSize);
+
+  /**
+   * @brief Returns the number of bytes needed to encode an entry.
+   *
+   * @param length The length of the suffix.
+   * @return size_t The full size of the entry in bytes.
+   */
+  static size_t entrySize(size_t length);
+
+  /**
+   * @brief Scans a bucket looking for a suffix.
+   *
+   * @param bucket The bucket to be scanned.
+   * @param suffix The suffix to look for.
+   * @param comparisons Incremented by one for every entry visited.
+   * @return const char* Pointer to the matching entry, or nullptr.
+   */
+  static const char *scan(const char *bucket, std::string_view suffix,
+                          size_t &comparisons);
+
+  /**
+   * @brief Appends an already encoded suffix/value index pair to a bucket.
+   *
+   * @param bucketIdx The bucket that receives the entry.
+   * @param suffix The suffix to be stored.
+   * @param valueIdx The index of the value in `values`.
+   */
+  void append(size_t bucketIdx, std::string_view suffix, uint32_t valueIdx);
+
+  /**
+   * @brief Doubles the number of buckets and redistributes every entry.
+   */
+  void grow();
+
+  /**
+   * @brief Releases every bucket block.
+   */
+  void releaseBuckets();
+
+public:
+  /**
+   * @brief Initial number of buckets of a new container.
+   */
+  static const size_t INITIAL_BUCKETS = 16;
+
+  /**
+   * @brief Average chain length that triggers the growth of the bucket array.
+   */
+  static const size_t MAX_AVERAGE_CHAIN = 8;
+
+  /**
+   * @brief Constructs an empty container.
+   *
+   * @param bucketCount The initial number of buckets (a power of two).
+   */
+  ArrayHash(size_t bucketCount = INITIAL_BUCKETS);
+
+  ArrayHash(const ArrayHash &) = delete;
+  ArrayHash &operator=(const ArrayHash &) = delete;
+
+  /**
+   * @brief Releases all memory held by the container.
+   */
+  ~ArrayHash();
+
+  /**
+   * @brief Looks a suffix up in the container.
+   *
+   * @param suffix The suffix to look for.
+   * @param comparisons Incremented by one for every entry visited.
+   * @return const Value* Pointer to the value of the suffix, or nullptr.
+   */
+  const Value *find(std::string_view suffix, size_t &comparisons) const;
+
+  /**
+   * @brief Returns the value of a suffix, inserting a default-constructed one
+   * if it is not present.
+   *
+   * @param suffix The suffix to look for.
+   * @param inserted Set to true when the suffix was not present.
+   * @param comparisons Incremented by one for every entry visited.
+   * @return Value& A reference to the value of the suffix. It is invalidated by
+   * the next insertion in the container.
+   */
+  Value &upsert(std::string_view suffix, bool &inserted, size_t &comparisons);
+
+  /**
+   * @brief Removes a suffix from the container.
+   *
+   * @param suffix The suffix to be removed.
+   * @param comparisons Incremented by one for every entry visited.
+   * @return true if the suffix was present; false otherwise.
+   */
+  bool erase(std::string_view suffix, size_t &comparisons);
+
+  /**
+   * @brief Calls `function(suffix, value)` for every entry of the container.
+   *
+   * @tparam Function A callable receiving a `std::string_view` and a
+   * `const Value &`.
+   * @param function The callable to be invoked.
+   */
+  template <typename Function> void forEach(Function function) const;
+
+  /**
+   * @brief Returns the number of keys stored in the container.
+   */
+  size_t size() const;
+
+  /**
+   * @brief Returns the number of bytes used by the container, including the
+   * bucket array, the bucket blocks and the value array.
+   */
+  size_t sizeOf() const;
+};
+
+#include "Tries/HAT/ArrayHash.impl.hpp"
+
+#endif
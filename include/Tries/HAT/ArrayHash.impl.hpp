@@ -0,0 +1,255 @@
+#include "Tries/HAT/ArrayHash.hpp"
+
+#include <cstring>
+#include <functional>
+
+template <typename Value>
+size_t ArrayHash<Value>::bucketOf(std::string_view suffix) const {
+  return std::hash<std::string_view>{}(suffix) & (buckets.size() - 1);
+}
+
+template <typename Value>
+size_t ArrayHash<Value>::readLength(const char *entry, size_t &headerSize) {
+  unsigned char first = static_cast<unsigned char>(entry[0]);
+
+  if (first < 255) {
+    headerSize = 1;
+    return first;
+  }
+
+  uint32_t length;
+  std::memcpy(&length, entry + 1, sizeof(uint32_t));
+  headerSize = 1 + sizeof(uint32_t);
+  return length;
+}
+
+template <typename Value> size_t ArrayHash<Value>::entrySize(size_t length) {
+  size_t headerSize = length < 255 ? 1 : 1 + sizeof(uint32_t);
+  return headerSize + length + sizeof(uint32_t);
+}
+
+template <typename Value>
+const char *ArrayHash<Value>::scan(const char *bucket, std::string_view suffix,
+                                   size_t &comparisons) {
+  if (!bucket)
+    return nullptr;
+
+  uint32_t used;
+  std::memcpy(&used, bucket, sizeof(uint32_t));
+
+  const char *entry = bucket + sizeof(uint32_t), *end = bucket + used;
+
+  while (entry < end) {
+    size_t headerSize, length = readLength(entry, headerSize);
+    comparisons++;
+
+    if (length == suffix.size() and
+        std::memcmp(entry + headerSize, suffix.data(), length) == 0)
+      return entry;
+
+    entry += headerSize + length + sizeof(uint32_t);
+  }
+
+  return nullptr;
+}
+
+template <typename Value>
+void ArrayHash<Value>::append(size_t bucketIdx, std::string_view suffix,
+                              uint32_t valueIdx) {
+  char *old = buckets[bucketIdx];
+  uint32_t used = sizeof(uint32_t);
+
+  if (old)
+    std::memcpy(&used, old, sizeof(uint32_t));
+
+  uint32_t newUsed = used + entrySize(suffix.size());
+  char *block = new char[newUsed];
+
+  if (old) {
+    std::memcpy(block, old, used);
+    delete[] old;
+    allocatedBytes -= used;
+  }
+
+  char *entry = block + used;
+
+  if (suffix.size() < 255) {
+    *entry++ = static_cast<char>(suffix.size());
+  } else {
+    uint32_t length = suffix.size();
+    *entry++ = static_cast<char>(255);
+    std::memcpy(entry, &length, sizeof(uint32_t));
+    entry += sizeof(uint32_t);
+  }
+
+  std::memcpy(entry, suffix.data(), suffix.size());
+  std::memcpy(entry + suffix.size(), &valueIdx, sizeof(uint32_t));
+  std::memcpy(block, &newUsed, sizeof(uint32_t));
+
+  buckets[bucketIdx] = block;
+  allocatedBytes += newUsed;
+}
+
+template <typename Value> void ArrayHash<Value>::grow() {
+  std::vector<char *> old(2 * buckets.size(), nullptr);
+  old.swap(buckets);
+  allocatedBytes = 0;
+
+  for (char *bucket : old) {
+    if (!bucket)
+      continue;
+
+    uint32_t used;
+    std::memcpy(&used, bucket, sizeof(uint32_t));
+
+    const char *entry = bucket + sizeof(uint32_t), *end = bucket + used;
+
+    while (entry < end) {
+      size_t headerSize, length = readLength(entry, headerSize);
+      std::string_view suffix(entry + headerSize, length);
+
+      uint32_t valueIdx;
+      std::memcpy(&valueIdx, entry + headerSize + length, sizeof(uint32_t));
+
+      append(bucketOf(suffix), suffix, valueIdx);
+      entry += headerSize + length + sizeof(uint32_t);
+    }
+
+    delete[] bucket;
+  }
+}
+
+template <typename Value> void ArrayHash<Value>::releaseBuckets() {
+  for (char *&bucket : buckets) {
+    delete[] bucket;
+    bucket = nullptr;
+  }
+
+  allocatedBytes = 0;
+}
+
+template <typename Value>
+ArrayHash<Value>::ArrayHash(size_t bucketCount)
+    : buckets(bucketCount, nullptr), numberOfElements(0), allocatedBytes(0) {}
+
+template <typename Value> ArrayHash<Value>::~ArrayHash() { releaseBuckets(); }
+
+template <typename Value>
+const Value *ArrayHash<Value>::find(std::string_view suffix,
+                                    size_t &comparisons) const {
+  const char *entry = scan(buckets[bucketOf(suffix)], suffix, comparisons);
+
+  if (!entry)
+    return nullptr;
+
+  size_t headerSize, length = readLength(entry, headerSize);
+  uint32_t valueIdx;
+  std::memcpy(&valueIdx, entry + headerSize + length, sizeof(uint32_t));
+
+  return &values[valueIdx];
+}
+
+template <typename Value>
+Value &ArrayHash<Value>::upsert(std::string_view suffix, bool &inserted,
+                                size_t &comparisons) {
+  const Value *found = find(suffix, comparisons);
+
+  if (found) {
+    inserted = false;
+    return const_cast<Value &>(*found);
+  }
+
+  uint32_t valueIdx;
+
+  if (!freeValues.empty()) {
+    valueIdx = freeValues.back();
+    freeValues.pop_back();
+    values[valueIdx] = Value();
+  } else {
+    valueIdx = values.size();
+    values.emplace_back();
+  }
+
+  append(bucketOf(suffix), suffix, valueIdx);
+  numberOfElements++;
+  inserted = true;
+
+  if (numberOfElements > MAX_AVERAGE_CHAIN * buckets.size())
+    grow();
+
+  return values[valueIdx];
+}
+
+template <typename Value>
+bool ArrayHash<Value>::erase(std::string_view suffix, size_t &comparisons) {
+  size_t bucketIdx = bucketOf(suffix);
+  char *bucket = buckets[bucketIdx];
+  const char *entry = scan(bucket, suffix, comparisons);
+
+  if (!entry)
+    return false;
+
+  uint32_t used;
+  std::memcpy(&used, bucket, sizeof(uint32_t));
+
+  size_t headerSize, length = readLength(entry, headerSize);
+  size_t size = headerSize + length + sizeof(uint32_t),
+         offset = entry - bucket;
+
+  uint32_t valueIdx;
+  std::memcpy(&valueIdx, entry + headerSize + length, sizeof(uint32_t));
+  freeValues.push_back(valueIdx);
+
+  uint32_t newUsed = used - size;
+  char *block = nullptr;
+
+  if (newUsed > sizeof(uint32_t)) {
+    block = new char[newUsed];
+    std::memcpy(block, bucket, offset);
+    std::memcpy(block + offset, bucket + offset + size, used - offset - size);
+    std::memcpy(block, &newUsed, sizeof(uint32_t));
+    allocatedBytes += newUsed;
+  }
+
+  delete[] bucket;
+  allocatedBytes -= used;
+  buckets[bucketIdx] = block;
+  numberOfElements--;
+
+  return true;
+}
+
+template <typename Value>
+template <typename Function>
+void ArrayHash<Value>::forEach(Function function) const {
+  for (const char *bucket : buckets) {
+    if (!bucket)
+      continue;
+
+    uint32_t used;
+    std::memcpy(&used, bucket, sizeof(uint32_t));
+
+    const char *entry = bucket + sizeof(uint32_t), *end = bucket + used;
+
+    while (entry < end) {
+      size_t headerSize, length = readLength(entry, headerSize);
+
+      uint32_t valueIdx;
+      std::memcpy(&valueIdx, entry + headerSize + length, sizeof(uint32_t));
+
+      function(std::string_view(entry + headerSize, length),
+               values[valueIdx]);
+      entry += headerSize + length + sizeof(uint32_t);
+    }
+  }
+}
+
+template <typename Value> size_t ArrayHash<Value>::size() const {
+  return numberOfElements;
+}
+
+template <typename Value> size_t ArrayHash<Value>::sizeOf() const {
+  return sizeof(*this) + buckets.capacity() * sizeof(char *) +
+         allocatedBytes + values.capacity() * sizeof(Value) +
+         freeValues.capacity() * sizeof(uint32_t);
+}
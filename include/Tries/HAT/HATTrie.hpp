@@ -0,0 +1,256 @@
+#ifndef HAT_TRIE_HPP
+#define HAT_TRIE_HPP
+
+#include <iostream>
+#include <string>
+
+#include "Dictionary/IDictionary.hpp"
+#include "Tries/HAT/ArrayHash.hpp"
+#include "Tries/HAT/HATTrieNode.hpp"
+
+/**
+ * @brief A HAT-trie: a burst trie whose leaves are cache-conscious array hash
+ * containers.
+ *
+ * Keys are first routed byte by byte through a (usually very shallow) trie of
+ * HATTrieNode objects. Once the path cannot be followed any further, the rest
+ * of the key is stored in an ArrayHash container, where all the suffixes of a
+ * bucket share one contiguous block of memory. When a container grows past
+ * `burstThreshold` keys it is burst: it is replaced by a new trie node and its
+ * suffixes are redistributed, according to their first byte, over new and
+ * smaller containers.
+ *
+ * Since no per-key node is allocated, the structure is considerably denser
+ * than the trees and the chained hash table for large vocabularies.
+ *
+ * @tparam Key The type of the keys. It must be explicitly convertible to
+ * `const std::string &` and constructible from `std::string`.
+ * @tparam Value The type of the values.
+ */
+template <typename Key, typename Value>
+class HATTrie : public IDictionary<Key, Value> {
+  /**
+   * @brief The root of the trie. It is never null.
+   */
+  HATTrieNode<Value> *root;
+
+  /**
+   * @brief The number of keys stored in the trie.
+   */
+  size_t numberOfElements;
+
+  /**
+   * @brief The number of keys a container may hold before being burst.
+   */
+  size_t burstThreshold;
+
+  /**
+   * @brief The number of containers burst so far.
+   */
+  size_t burstsCount;
+
+  /**
+   * @brief The number of trie nodes currently allocated, root included.
+   */
+  size_t nodesCount;
+
+  /**
+   * @brief Returns the raw bytes of a key.
+   *
+   * @param key The key.
+   * @return const std::string& The bytes the trie branches on.
+   */
+  static const std::string &bytesOf(const Key &key);
+
+  /**
+   * @brief Looks a key up without modifying the trie.
+   *
+   * @param key The bytes of the key.
+   * @return const Value* A pointer to the value of the key, or nullptr if the
+   * key is not present.
+   */
+  const Value *findValue(const std::string &key) const;
+
+  /**
+   * @brief Returns the value of a key, inserting a default-constructed value if
+   * the key is not present. Bursts the container that receives the key when it
+   * overflows.
+   *
+   * @param key The bytes of the key.
+   * @param inserted Set to true if the key was not present.
+   * @return Value& A reference to the value of the key.
+   */
+  Value &upsert(const std::string &key, bool &inserted);
+
+  /**
+   * @brief Bursts the container stored in the child slot `c` of `node`.
+   *
+   * @param node The node that owns the container.
+   * @param c The byte of the child slot.
+   */
+  void burst(HATTrieNode<Value> *node, unsigned char c);
+
+  /**
+   * @brief Releases a node, its containers and all of its descendants.
+   *
+   * @param node The node to be released.
+   */
+  void clearNode(HATTrieNode<Value> *node);
+
+  /**
+   * @brief Calls `function(key, value)` for every key below `node`.
+   *
+   * @tparam Function A callable receiving a `const std::string &` and a
+   * `const Value &`.
+   * @param node The node where the traversal starts.
+   * @param prefix The bytes consumed from the root down to `node`.
+   * @param function The callable to be invoked.
+   */
+  template <typename Function>
+  void forEachNode(const HATTrieNode<Value> *node, std::string &prefix,
+                   Function function) const;
+
+  /**
+   * @brief Returns the number of bytes used by `node` and its descendants.
+   *
+   * @param node The node where the computation starts.
+   */
+  size_t sizeOfNode(const HATTrieNode<Value> *node) const;
+
+public:
+  /**
+   * @brief Default container capacity before a burst, as suggested by Askitis
+   * and Sinha for the HAT-trie.
+   */
+  static const size_t DEFAULT_BURST_THRESHOLD = 16384;
+
+  /**
+   * @brief Constructs an empty HAT-trie.
+   *
+   * @param threshold The number of keys a container may hold before being
+   * burst. Defaults to DEFAULT_BURST_THRESHOLD.
+   */
+  HATTrie(size_t threshold = DEFAULT_BURST_THRESHOLD);
+
+  HATTrie(const HATTrie &) = delete;
+  HATTrie &operator=(const HATTrie &) = delete;
+
+  /**
+   * @brief Releases every node and container.
+   */
+  ~HATTrie();
+
+  /**
+   * @brief Inserts a key-value pair into the trie.
+   *
+   * @param key The key to be inserted.
+   * @param value The value associated with the key.
+   * @throws KeyAlreadyExistsException If the key is already present.
+   */
+  void insert(const Key &key, const Value &value) override;
+
+  /**
+   * @brief Searches for a key and retrieves its value if found.
+   *
+   * @param key The key to search for.
+   * @param outValue Receives the value of the key, if found.
+   * @return true if the key is found; false otherwise.
+   */
+  bool find(const Key &key, Value &outValue) const override;
+
+  /**
+   * @brief Updates the value associated with an existing key.
+   *
+   * @param key The key to be updated.
+   * @param value The new value.
+   * @throws KeyNotFoundException If the key is not present.
+   */
+  void update(const Key &key, const Value &value) override;
+
+  /**
+   * @brief Removes a key from the trie. Does nothing if the key is absent.
+   *
+   * Containers are not merged back into their parents after removals.
+   *
+   * @param key The key to be removed.
+   */
+  void remove(const Key &key) override;
+
+  /**
+   * @brief Removes every key, leaving only an empty root node.
+   */
+  void clear() override;
+
+  /**
+   * @brief Prints the key-value pairs in ascending order of keys.
+   *
+   * The trie orders keys by their bytes, while `Key::operator<` may follow a
+   * different collation, so the pairs are gathered and sorted before printing.
+   *
+   * @param out The output stream.
+   */
+  void printInOrder(std::ostream &out) const override;
+
+  /**
+   * @brief Calls a function on every key-value pair, in no particular order.
+   *
+   * @param action The function called with each key and value.
+   */
+  void forEach(const std::function<void(const Key &, const Value &)> &action)
+      const override;
+
+  /**
+   * @brief Returns the number of key comparisons made inside the containers.
+   *
+   * Branching on a trie node is an array index and is not counted.
+   */
+  size_t getComparisonsCount() const override;
+
+  /**
+   * @brief Returns a reference to the value of a key, inserting a
+   * default-constructed value if the key is not present.
+   *
+   * @param key The key to access.
+   * @return Value& A reference to the value. It is invalidated by the next
+   * insertion.
+   */
+  Value &operator[](const Key &key) override;
+
+  /**
+   * @brief Returns a const reference to the value of a key.
+   *
+   * @param key The key to access.
+   * @return const Value& A reference to the value.
+   * @throws KeyNotFoundException If the key is not present.
+   */
+  const Value &operator[](const Key &key) const override;
+
+  /**
+   * @brief Returns the number of containers burst so far.
+   */
+  size_t getBurstsCount() const;
+
+  /**
+   * @brief Returns the number of trie nodes, root included.
+   */
+  size_t getNodesCount() const;
+
+  /**
+   * @brief Accepts a visitor implementing IDictionaryVisitor interface to
+   * collect metrics or perform operations on the HATTrie.
+   *
+   * @param visitor A reference to an IDictionaryVisitor<Key, Value> object that
+   * will interact with the HATTrie.
+   */
+  void accept(IDictionaryVisitor<Key, Value> &visitor) const override;
+
+  /**
+   * @brief Returns the number of bytes used by the trie nodes, the container
+   * bucket arrays, the bucket blocks and the value arrays.
+   */
+  size_t getMemoryUsage() const override;
+};
+
+#include "Tries/HAT/HATTrie.impl.hpp"
+
+#endif
@@ -0,0 +1,326 @@
+#include "Tries/HAT/HATTrie.hpp"
+
+#include <algorithm>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "Exceptions/KeyExceptions.hpp"
+#include "Utils/Strings/StringHandler.hpp"
+
+template <typename Key, typename Value>
+const std::string &HATTrie<Key, Value>::bytesOf(const Key &key) {
+  return static_cast<const std::string &>(key);
+}
+
+template <typename Key, typename Value>
+const Value *HATTrie<Key, Value>::findValue(const std::string &key) const {
+  const HATTrieNode<Value> *node = root;
+
+  for (size_t pos = 0; pos < key.size(); pos++) {
+    const auto &child = node->children[static_cast<unsigned char>(key[pos])];
+
+    if (child.node) {
+      node = child.node;
+      continue;
+    }
+
+    if (!child.container)
+      return nullptr;
+
+    size_t comparisons = 0;
+    const Value *value = child.container->find(
+        std::string_view(key).substr(pos + 1), comparisons);
+    this->incrementCounter(comparisons);
+
+    return value;
+  }
+
+  return node->hasValue ? &node->value : nullptr;
+}
+
+template <typename Key, typename Value>
+Value &HATTrie<Key, Value>::upsert(const std::string &key, bool &inserted) {
+  HATTrieNode<Value> *node = root;
+
+  for (size_t pos = 0; pos < key.size(); pos++) {
+    unsigned char c = key[pos];
+    auto &child = node->children[c];
+
+    if (child.node) {
+      node = child.node;
+      continue;
+    }
+
+    if (!child.container)
+      child.container = new ArrayHash<Value>();
+
+    size_t comparisons = 0;
+    Value &value = child.container->upsert(
+        std::string_view(key).substr(pos + 1), inserted, comparisons);
+    this->incrementCounter(comparisons);
+
+    if (!inserted)
+      return value;
+
+    numberOfElements++;
+
+    if (child.container->size() <= burstThreshold)
+      return value;
+
+    burst(node, c);
+
+    bool again;
+    return upsert(key, again);
+  }
+
+  inserted = !node->hasValue;
+
+  if (inserted) {
+    node->hasValue = true;
+    node->value = Value();
+    numberOfElements++;
+  }
+
+  return node->value;
+}
+
+template <typename Key, typename Value>
+void HATTrie<Key, Value>::burst(HATTrieNode<Value> *node, unsigned char c) {
+  auto &child = node->children[c];
+  HATTrieNode<Value> *newNode = new HATTrieNode<Value>();
+
+  child.container->forEach([newNode](std::string_view suffix,
+                                     const Value &value) {
+    if (suffix.empty()) {
+      newNode->hasValue = true;
+      newNode->value = value;
+      return;
+    }
+
+    auto &grandChild = newNode->children[static_cast<unsigned char>(suffix[0])];
+
+    if (!grandChild.container)
+      grandChild.container = new ArrayHash<Value>();
+
+    bool inserted;
+    size_t comparisons = 0;
+    grandChild.container->upsert(suffix.substr(1), inserted, comparisons) =
+        value;
+  });
+
+  delete child.container;
+  child.container = nullptr;
+  child.node = newNode;
+
+  nodesCount++;
+  burstsCount++;
+}
+
+template <typename Key, typename Value>
+void HATTrie<Key, Value>::clearNode(HATTrieNode<Value> *node) {
+  for (auto &child : node->children) {
+    if (child.node)
+      clearNode(child.node);
+
+    delete child.container;
+  }
+
+  delete node;
+}
+
+template <typename Key, typename Value>
+template <typename Function>
+void HATTrie<Key, Value>::forEachNode(const HATTrieNode<Value> *node,
+                                      std::string &prefix,
+                                      Function function) const {
+  if (node->hasValue)
+    function(prefix, node->value);
+
+  for (size_t c = 0; c < node->children.size(); c++) {
+    const auto &child = node->children[c];
+
+    prefix.push_back(static_cast<char>(c));
+
+    if (child.node) {
+      forEachNode(child.node, prefix, function);
+    } else if (child.container) {
+      child.container->forEach(
+          [&prefix, &function](std::string_view suffix, const Value &value) {
+            function(prefix + std::string(suffix), value);
+          });
+    }
+
+    prefix.pop_back();
+  }
+}
+
+template <typename Key, typename Value>
+size_t HATTrie<Key, Value>::sizeOfNode(const HATTrieNode<Value> *node) const {
+  size_t size = sizeof(HATTrieNode<Value>);
+
+  for (const auto &child : node->children) {
+    if (child.node)
+      size += sizeOfNode(child.node);
+    else if (child.container)
+      size += child.container->sizeOf();
+  }
+
+  return size;
+}
+
+template <typename Key, typename Value>
+HATTrie<Key, Value>::HATTrie(size_t threshold)
+    : root(new HATTrieNode<Value>()), numberOfElements(0),
+      burstThreshold(threshold == 0 ? DEFAULT_BURST_THRESHOLD : threshold),
+      burstsCount(0), nodesCount(1) {}
+
+template <typename Key, typename Value> HATTrie<Key, Value>::~HATTrie() {
+  clearNode(root);
+}
+
+template <typename Key, typename Value>
+void HATTrie<Key, Value>::insert(const Key &key, const Value &value) {
+  bool inserted;
+  Value &slot = upsert(bytesOf(key), inserted);
+
+  if (!inserted)
+    throw KeyAlreadyExistsException();
+
+  slot = value;
+}
+
+template <typename Key, typename Value>
+bool HATTrie<Key, Value>::find(const Key &key, Value &outValue) const {
+  const Value *value = findValue(bytesOf(key));
+
+  if (!value)
+    return false;
+
+  outValue = *value;
+  return true;
+}
+
+template <typename Key, typename Value>
+void HATTrie<Key, Value>::update(const Key &key, const Value &value) {
+  const Value *slot = findValue(bytesOf(key));
+
+  if (!slot)
+    throw KeyNotFoundException();
+
+  *const_cast<Value *>(slot) = value;
+}
+
+template <typename Key, typename Value>
+void HATTrie<Key, Value>::remove(const Key &key) {
+  const std::string &bytes = bytesOf(key);
+  HATTrieNode<Value> *node = root;
+
+  for (size_t pos = 0; pos < bytes.size(); pos++) {
+    auto &child = node->children[static_cast<unsigned char>(bytes[pos])];
+
+    if (child.node) {
+      node = child.node;
+      continue;
+    }
+
+    if (!child.container)
+      return;
+
+    size_t comparisons = 0;
+    if (child.container->erase(std::string_view(bytes).substr(pos + 1),
+                               comparisons))
+      numberOfElements--;
+    this->incrementCounter(comparisons);
+
+    return;
+  }
+
+  if (node->hasValue) {
+    node->hasValue = false;
+    numberOfElements--;
+  }
+}
+
+template <typename Key, typename Value> void HATTrie<Key, Value>::clear() {
+  clearNode(root);
+  root = new HATTrieNode<Value>();
+  numberOfElements = 0;
+  burstsCount = 0;
+  nodesCount = 1;
+  this->resetCounter();
+}
+
+template <typename Key, typename Value>
+void HATTrie<Key, Value>::printInOrder(std::ostream &out) const {
+  size_t maxKeyLen = 0, maxValLen = 0;
+  std::vector<std::pair<Key, Value>> vec;
+  vec.reserve(numberOfElements);
+
+  std::string prefix;
+  forEachNode(root, prefix,
+              [&](const std::string &key, const Value &value) {
+                vec.emplace_back(Key(key), value);
+                maxKeyLen = std::max(maxKeyLen, StringHandler::size(key));
+                maxValLen = std::max(maxValLen, StringHandler::size(value));
+              });
+
+  std::sort(vec.begin(), vec.end(),
+            [](const auto &pa, const auto &pb) { return pa.first < pb.first; });
+
+  for (const auto &p : vec) {
+    out << StringHandler::SetWidthAtLeft(p.first, maxKeyLen) << " | "
+        << StringHandler::SetWidthAtLeft(p.second, maxValLen) << "\n";
+  }
+}
+
+template <typename Key, typename Value>
+void HATTrie<Key, Value>::forEach(
+    const std::function<void(const Key &, const Value &)> &action) const {
+  std::string prefix;
+  forEachNode(root, prefix, [&](const std::string &key, const Value &value) {
+    action(Key(key), value);
+  });
+}
+
+template <typename Key, typename Value>
+size_t HATTrie<Key, Value>::getComparisonsCount() const {
+  return this->comparisonsCount;
+}
+
+template <typename Key, typename Value>
+Value &HATTrie<Key, Value>::operator[](const Key &key) {
+  bool inserted;
+  return upsert(bytesOf(key), inserted);
+}
+
+template <typename Key, typename Value>
+const Value &HATTrie<Key, Value>::operator[](const Key &key) const {
+  const Value *value = findValue(bytesOf(key));
+
+  if (!value)
+    throw KeyNotFoundException();
+
+  return *value;
+}
+
+template <typename Key, typename Value>
+size_t HATTrie<Key, Value>::getBurstsCount() const {
+  return burstsCount;
+}
+
+template <typename Key, typename Value>
+size_t HATTrie<Key, Value>::getNodesCount() const {
+  return nodesCount;
+}
+
+template <typename Key, typename Value>
+void HATTrie<Key, Value>::accept(
+    IDictionaryVisitor<Key, Value> &visitor) const {
+  visitor.collectMetrics(*this);
+}
+
+template <typename Key, typename Value>
+size_t HATTrie<Key, Value>::getMemoryUsage() const {
+  return sizeof(*this) + sizeOfNode(root);
+}
@@ -0,0 +1,54 @@
+#ifndef HAT_TRIE_NODE_HPP
+#define HAT_TRIE_NODE_HPP
+
+#include <array>
+
+#include "Tries/HAT/ArrayHash.hpp"
+
+/**
+ * @brief Internal node of a HAT-trie.
+ *
+ * Every node branches on one byte of the key. A child slot either points to
+ * another trie node or to an ArrayHash container holding the remaining
+ * suffixes of all the keys that share the path up to that slot (never both).
+ *
+ * @tparam Value The type of the values stored in the trie.
+ */
+template <typename Value> struct HATTrieNode {
+  /**
+   * @brief A child slot of the node.
+   */
+  struct Child {
+    /**
+     * @brief The child trie node, if the slot has already burst.
+     */
+    HATTrieNode *node = nullptr;
+
+    /**
+     * @brief The container holding the suffixes below this slot.
+     */
+    ArrayHash<Value> *container = nullptr;
+  };
+
+  /**
+   * @brief One child slot per possible byte value.
+   */
+  std::array<Child, 256> children;
+
+  /**
+   * @brief Whether a key ends exactly at this node.
+   */
+  bool hasValue;
+
+  /**
+   * @brief The value of the key that ends at this node, if any.
+   */
+  Value value;
+
+  /**
+   * @brief Constructs a node without children and without a value.
+   */
+  HATTrieNode() : children(), hasValue(false), value() {}
+};
+
+#endif
@@ -0,0 +1,55 @@
+#ifndef TERNARY_NODE_HPP
+#define TERNARY_NODE_HPP
+
+/**
+ * @brief Node of a ternary search tree.
+ *
+ * Each node holds a single byte of a key. Keys whose byte at the current depth
+ * is smaller or greater than `splitChar` continue on the left or right
+ * subtrees, while keys sharing it continue on the middle subtree with the next
+ * byte. Keys with a common prefix therefore share the nodes of that prefix.
+ *
+ * @tparam Value The type of the values stored in the tree.
+ */
+template <typename Value> struct TernaryNode {
+  /**
+   * @brief The byte of the key represented by this node.
+   */
+  unsigned char splitChar;
+
+  /**
+   * @brief Subtree of the keys whose byte at this depth is smaller.
+   */
+  TernaryNode *left;
+
+  /**
+   * @brief Subtree of the keys that continue past this byte.
+   */
+  TernaryNode *mid;
+
+  /**
+   * @brief Subtree of the keys whose byte at this depth is greater.
+   */
+  TernaryNode *right;
+
+  /**
+   * @brief Whether a key ends exactly at this node.
+   */
+  bool hasValue;
+
+  /**
+   * @brief The value of the key that ends at this node, if any.
+   */
+  Value value;
+
+  /**
+   * @brief Constructs a leaf node for the given byte.
+   *
+   * @param c The byte represented by the node.
+   */
+  TernaryNode(unsigned char c)
+      : splitChar(c), left(nullptr), mid(nullptr), right(nullptr),
+        hasValue(false), value() {}
+};
+
+#endif
@@ -0,0 +1,215 @@
+#ifndef TERNARY_SEARCH_TREE_HPP
+#define TERNARY_SEARCH_TREE_HPP
+
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Dictionary/IDictionary.hpp"
+#include "Tries/Ternary/TernaryNode.hpp"
+
+/**
+ * @brief A ternary search tree (Bentley and Sedgewick).
+ *
+ * Keys are compared one byte at a time instead of as whole strings, and keys
+ * sharing a prefix share the nodes of that prefix. A lookup costs at most one
+ * byte comparison per level, and a mismatch is usually detected after a few
+ * bytes rather than after a full string comparison.
+ *
+ * Besides the dictionary operations, the tree enumerates every key starting
+ * with a given prefix (see prefixedBy()).
+ *
+ * @tparam Key The type of the keys. It must be explicitly convertible to
+ * `const std::string &` and constructible from `std::string`.
+ * @tparam Value The type of the values.
+ */
+template <typename Key, typename Value>
+class TernarySearchTree : public IDictionary<Key, Value> {
+  /**
+   * @brief The root of the tree, or nullptr if no non-empty key was inserted.
+   */
+  TernaryNode<Value> *root;
+
+  /**
+   * @brief Whether the empty key is present. It has no node of its own.
+   */
+  bool hasEmptyKey;
+
+  /**
+   * @brief The value of the empty key, if present.
+   */
+  Value emptyKeyValue;
+
+  /**
+   * @brief The number of keys stored in the tree.
+   */
+  size_t numberOfElements;
+
+  /**
+   * @brief The number of nodes currently allocated.
+   */
+  size_t nodesCount;
+
+  /**
+   * @brief Returns the raw bytes of a key.
+   *
+   * @param key The key.
+   * @return const std::string& The bytes the tree branches on.
+   */
+  static const std::string &bytesOf(const Key &key);
+
+  /**
+   * @brief Finds the node of the last byte of a non-empty string.
+   *
+   * @param bytes The string to look for.
+   * @return const TernaryNode<Value>* The node where `bytes` ends, or nullptr
+   * if no key starts with `bytes`.
+   */
+  const TernaryNode<Value> *findNode(const std::string &bytes) const;
+
+  /**
+   * @brief Returns the value of a key, inserting a default-constructed value if
+   * the key is not present.
+   *
+   * @param bytes The bytes of the key.
+   * @param inserted Set to true if the key was not present.
+   * @return Value& A reference to the value of the key.
+   */
+  Value &upsert(const std::string &bytes, bool &inserted);
+
+  /**
+   * @brief Collects, in byte order, every key stored in a subtree.
+   *
+   * @param node The root of the subtree.
+   * @param prefix The bytes consumed before reaching `node`.
+   * @param out The vector that receives the key-value pairs.
+   */
+  void collect(const TernaryNode<Value> *node, std::string &prefix,
+               std::vector<std::pair<Key, Value>> &out) const;
+
+public:
+  /**
+   * @brief Constructs an empty ternary search tree.
+   */
+  TernarySearchTree();
+
+  TernarySearchTree(const TernarySearchTree &) = delete;
+  TernarySearchTree &operator=(const TernarySearchTree &) = delete;
+
+  /**
+   * @brief Releases every node.
+   */
+  ~TernarySearchTree();
+
+  /**
+   * @brief Inserts a key-value pair into the tree.
+   *
+   * @param key The key to be inserted.
+   * @param value The value associated with the key.
+   * @throws KeyAlreadyExistsException If the key is already present.
+   */
+  void insert(const Key &key, const Value &value) override;
+
+  /**
+   * @brief Searches for a key and retrieves its value if found.
+   *
+   * @param key The key to search for.
+   * @param outValue Receives the value of the key, if found.
+   * @return true if the key is found; false otherwise.
+   */
+  bool find(const Key &key, Value &outValue) const override;
+
+  /**
+   * @brief Updates the value associated with an existing key.
+   *
+   * @param key The key to be updated.
+   * @param value The new value.
+   * @throws KeyNotFoundException If the key is not present.
+   */
+  void update(const Key &key, const Value &value) override;
+
+  /**
+   * @brief Removes a key from the tree. Does nothing if the key is absent.
+   *
+   * The nodes of the key are kept, since they may be shared with other keys.
+   *
+   * @param key The key to be removed.
+   */
+  void remove(const Key &key) override;
+
+  /**
+   * @brief Removes every key and releases every node.
+   */
+  void clear() override;
+
+  /**
+   * @brief Prints the key-value pairs in ascending order of keys.
+   *
+   * The tree orders keys by their bytes, while `Key::operator<` may follow a
+   * different collation, so the pairs are gathered and sorted before printing.
+   *
+   * @param out The output stream.
+   */
+  void printInOrder(std::ostream &out) const override;
+
+  /**
+   * @brief Calls a function on every key-value pair, in byte order of key.
+   *
+   * @param action The function called with each key and value.
+   */
+  void forEach(const std::function<void(const Key &, const Value &)> &action)
+      const override;
+
+  /**
+   * @brief Returns the number of byte comparisons made so far.
+   */
+  size_t getComparisonsCount() const override;
+
+  /**
+   * @brief Returns a reference to the value of a key, inserting a
+   * default-constructed value if the key is not present.
+   *
+   * @param key The key to access.
+   * @return Value& A reference to the value.
+   */
+  Value &operator[](const Key &key) override;
+
+  /**
+   * @brief Returns a const reference to the value of a key.
+   *
+   * @param key The key to access.
+   * @return const Value& A reference to the value.
+   * @throws KeyNotFoundException If the key is not present.
+   */
+  const Value &operator[](const Key &key) const override;
+
+  /**
+   * @brief Enumerates every key starting with a prefix.
+   *
+   * @param prefix The prefix. An empty prefix enumerates the whole tree.
+   * @return std::vector<std::pair<Key, Value>> The matching key-value pairs, in
+   * byte order.
+   */
+  std::vector<std::pair<Key, Value>> prefixedBy(const Key &prefix) const;
+
+  /**
+   * @brief Returns the number of nodes of the tree.
+   */
+  size_t getNodesCount() const;
+
+  /**
+   * @brief Accepts a visitor implementing IDictionaryVisitor interface to
+   * collect metrics or perform operations on the TernarySearchTree.
+   *
+   * @param visitor A reference to an IDictionaryVisitor<Key, Value> object that
+   * will interact with the TernarySearchTree.
+   */
+  void accept(IDictionaryVisitor<Key, Value> &visitor) const override;
+
+  size_t getMemoryUsage() const override;
+};
+
+#include "Tries/Ternary/TernarySearchTree.impl.hpp"
+
+#endif
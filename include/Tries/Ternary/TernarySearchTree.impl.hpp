@@ -0,0 +1,318 @@
+#include "Tries/Ternary/TernarySearchTree.hpp"
+
+#include <algorithm>
+
+#include "Exceptions/KeyExceptions.hpp"
+#include "Utils/Strings/StringHandler.hpp"
+
+template <typename Key, typename Value>
+const std::string &TernarySearchTree<Key, Value>::bytesOf(const Key &key) {
+  return static_cast<const std::string &>(key);
+}
+
+template <typename Key, typename Value>
+const TernaryNode<Value> *
+TernarySearchTree<Key, Value>::findNode(const std::string &bytes) const {
+  const TernaryNode<Value> *node = root;
+  size_t pos = 0;
+
+  while (node) {
+    unsigned char c = bytes[pos];
+
+    if (c < node->splitChar) {
+      this->incrementCounter(1);
+      node = node->left;
+    } else if (c > node->splitChar) {
+      this->incrementCounter(2);
+      node = node->right;
+    } else {
+      this->incrementCounter(2);
+
+      if (++pos == bytes.size())
+        return node;
+
+      node = node->mid;
+    }
+  }
+
+  return nullptr;
+}
+
+template <typename Key, typename Value>
+Value &TernarySearchTree<Key, Value>::upsert(const std::string &bytes,
+                                             bool &inserted) {
+  if (bytes.empty()) {
+    inserted = !hasEmptyKey;
+
+    if (inserted) {
+      hasEmptyKey = true;
+      emptyKeyValue = Value();
+      numberOfElements++;
+    }
+
+    return emptyKeyValue;
+  }
+
+  TernaryNode<Value> **link = &root;
+  size_t pos = 0;
+
+  while (true) {
+    unsigned char c = bytes[pos];
+
+    if (!*link) {
+      *link = new TernaryNode<Value>(c);
+      nodesCount++;
+    }
+
+    TernaryNode<Value> *node = *link;
+
+    if (c < node->splitChar) {
+      this->incrementCounter(1);
+      link = &node->left;
+    } else if (c > node->splitChar) {
+      this->incrementCounter(2);
+      link = &node->right;
+    } else {
+      this->incrementCounter(2);
+
+      if (++pos == bytes.size()) {
+        inserted = !node->hasValue;
+
+        if (inserted) {
+          node->hasValue = true;
+          node->value = Value();
+          numberOfElements++;
+        }
+
+        return node->value;
+      }
+
+      link = &node->mid;
+    }
+  }
+}
+
+template <typename Key, typename Value>
+void TernarySearchTree<Key, Value>::collect(
+    const TernaryNode<Value> *node, std::string &prefix,
+    std::vector<std::pair<Key, Value>> &out) const {
+  if (!node)
+    return;
+
+  collect(node->left, prefix, out);
+
+  prefix.push_back(static_cast<char>(node->splitChar));
+
+  if (node->hasValue)
+    out.emplace_back(Key(prefix), node->value);
+
+  collect(node->mid, prefix, out);
+  prefix.pop_back();
+
+  collect(node->right, prefix, out);
+}
+
+template <typename Key, typename Value>
+TernarySearchTree<Key, Value>::TernarySearchTree()
+    : root(nullptr), hasEmptyKey(false), emptyKeyValue(), numberOfElements(0),
+      nodesCount(0) {}
+
+template <typename Key, typename Value>
+TernarySearchTree<Key, Value>::~TernarySearchTree() {
+  clear();
+}
+
+template <typename Key, typename Value>
+void TernarySearchTree<Key, Value>::insert(const Key &key, const Value &value) {
+  bool inserted;
+  Value &slot = upsert(bytesOf(key), inserted);
+
+  if (!inserted)
+    throw KeyAlreadyExistsException();
+
+  slot = value;
+}
+
+template <typename Key, typename Value>
+bool TernarySearchTree<Key, Value>::find(const Key &key,
+                                         Value &outValue) const {
+  const std::string &bytes = bytesOf(key);
+
+  if (bytes.empty()) {
+    if (hasEmptyKey)
+      outValue = emptyKeyValue;
+    return hasEmptyKey;
+  }
+
+  const TernaryNode<Value> *node = findNode(bytes);
+
+  if (!node or !node->hasValue)
+    return false;
+
+  outValue = node->value;
+  return true;
+}
+
+template <typename Key, typename Value>
+void TernarySearchTree<Key, Value>::update(const Key &key, const Value &value) {
+  const std::string &bytes = bytesOf(key);
+
+  if (bytes.empty()) {
+    if (!hasEmptyKey)
+      throw KeyNotFoundException();
+
+    emptyKeyValue = value;
+    return;
+  }
+
+  TernaryNode<Value> *node = const_cast<TernaryNode<Value> *>(findNode(bytes));
+
+  if (!node or !node->hasValue)
+    throw KeyNotFoundException();
+
+  node->value = value;
+}
+
+template <typename Key, typename Value>
+void TernarySearchTree<Key, Value>::remove(const Key &key) {
+  const std::string &bytes = bytesOf(key);
+
+  if (bytes.empty()) {
+    if (hasEmptyKey) {
+      hasEmptyKey = false;
+      numberOfElements--;
+    }
+    return;
+  }
+
+  TernaryNode<Value> *node = const_cast<TernaryNode<Value> *>(findNode(bytes));
+
+  if (node and node->hasValue) {
+    node->hasValue = false;
+    numberOfElements--;
+  }
+}
+
+template <typename Key, typename Value>
+void TernarySearchTree<Key, Value>::clear() {
+  std::vector<TernaryNode<Value> *> stack;
+
+  if (root)
+    stack.push_back(root);
+
+  while (!stack.empty()) {
+    TernaryNode<Value> *node = stack.back();
+    stack.pop_back();
+
+    for (TernaryNode<Value> *child : {node->left, node->mid, node->right})
+      if (child)
+        stack.push_back(child);
+
+    delete node;
+  }
+
+  root = nullptr;
+  hasEmptyKey = false;
+  numberOfElements = 0;
+  nodesCount = 0;
+  this->resetCounter();
+}
+
+template <typename Key, typename Value>
+void TernarySearchTree<Key, Value>::printInOrder(std::ostream &out) const {
+  size_t maxKeyLen = 0, maxValLen = 0;
+  std::vector<std::pair<Key, Value>> vec = prefixedBy(Key());
+
+  for (const auto &p : vec) {
+    maxKeyLen = std::max(maxKeyLen, StringHandler::size(p.first));
+    maxValLen = std::max(maxValLen, StringHandler::size(p.second));
+  }
+
+  std::sort(vec.begin(), vec.end(),
+            [](const auto &pa, const auto &pb) { return pa.first < pb.first; });
+
+  for (const auto &p : vec) {
+    out << StringHandler::SetWidthAtLeft(p.first, maxKeyLen) << " | "
+        << StringHandler::SetWidthAtLeft(p.second, maxValLen) << "\n";
+  }
+}
+
+template <typename Key, typename Value>
+void TernarySearchTree<Key, Value>::forEach(
+    const std::function<void(const Key &, const Value &)> &action) const {
+  for (const auto &[key, value] : prefixedBy(Key()))
+    action(key, value);
+}
+
+template <typename Key, typename Value>
+size_t TernarySearchTree<Key, Value>::getComparisonsCount() const {
+  return this->comparisonsCount;
+}
+
+template <typename Key, typename Value>
+Value &TernarySearchTree<Key, Value>::operator[](const Key &key) {
+  bool inserted;
+  return upsert(bytesOf(key), inserted);
+}
+
+template <typename Key, typename Value>
+const Value &TernarySearchTree<Key, Value>::operator[](const Key &key) const {
+  const std::string &bytes = bytesOf(key);
+
+  if (bytes.empty()) {
+    if (!hasEmptyKey)
+      throw KeyNotFoundException();
+    return emptyKeyValue;
+  }
+
+  const TernaryNode<Value> *node = findNode(bytes);
+
+  if (!node or !node->hasValue)
+    throw KeyNotFoundException();
+
+  return node->value;
+}
+
+template <typename Key, typename Value>
+std::vector<std::pair<Key, Value>>
+TernarySearchTree<Key, Value>::prefixedBy(const Key &prefix) const {
+  std::vector<std::pair<Key, Value>> out;
+  std::string bytes = bytesOf(prefix);
+
+  if (bytes.empty()) {
+    out.reserve(numberOfElements);
+
+    if (hasEmptyKey)
+      out.emplace_back(Key(), emptyKeyValue);
+
+    collect(root, bytes, out);
+    return out;
+  }
+
+  const TernaryNode<Value> *node = findNode(bytes);
+
+  if (!node)
+    return out;
+
+  if (node->hasValue)
+    out.emplace_back(Key(bytes), node->value);
+
+  collect(node->mid, bytes, out);
+  return out;
+}
+
+template <typename Key, typename Value>
+size_t TernarySearchTree<Key, Value>::getNodesCount() const {
+  return nodesCount;
+}
+
+template <typename Key, typename Value>
+void TernarySearchTree<Key, Value>::accept(
+    IDictionaryVisitor<Key, Value> &visitor) const {
+  visitor.collectMetrics(*this);
+}
+
+template <typename Key, typename Value>
+size_t TernarySearchTree<Key, Value>::getMemoryUsage() const {
+  return sizeof(*this) + nodesCount * sizeof(TernaryNode<Value>);
+}
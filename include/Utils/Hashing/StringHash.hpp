@@ -0,0 +1,98 @@
+#ifndef STRING_HASH_HPP
+#define STRING_HASH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief The hash functions that can hash the words (`--hash=NAME`).
+ *
+ * - Std: `std::hash<std::string>` (MurmurHash2 in libstdc++), the default.
+ * - WyHash: wyhash (final version 4), built on 64x64->128-bit multiplications.
+ * - XXH3: a hash with the structure of XXH3: one path per length class, and
+ *   16-byte stripes folded by 128-bit multiplications with a secret. Its
+ *   secret is not XXH3's, so its values differ from the reference ones.
+ * - CRC32C: the CRC-32C (Castagnoli) checksum, computed 8 bytes at a time by
+ *   the SSE4.2 `crc32` instruction, or by a lookup table on processors
+ *   without it. The checksum has only 32 bits; it is spread over 64 bits by a
+ *   multiplication, but two words with the same checksum still collide.
+ */
+enum class StringHashFunction { Std, WyHash, XXH3, CRC32C };
+
+/**
+ * @namespace StringHash
+ * @brief The string hash functions and the one selected for the run.
+ *
+ * `std::hash<LexicalStr>` calls the selected function through a pointer, so
+ * every hashed dictionary follows the selection without a template parameter
+ * of its own. The selection must be made before any dictionary is built, and
+ * not while threads are hashing.
+ */
+namespace StringHash {
+/**
+ * @brief A function hashing `length` bytes starting at `data`.
+ */
+using Function = uint64_t (*)(const char *data, size_t length);
+
+/**
+ * @brief Hashes the bytes with `std::hash<std::string>`.
+ */
+uint64_t standard(const char *data, size_t length);
+
+/**
+ * @brief Hashes the bytes with wyhash.
+ */
+uint64_t wyhash(const char *data, size_t length);
+
+/**
+ * @brief Hashes the bytes with the XXH3-like hash.
+ */
+uint64_t xxh3(const char *data, size_t length);
+
+/**
+ * @brief Hashes the bytes with CRC-32C, spread over 64 bits.
+ */
+uint64_t crc32c(const char *data, size_t length);
+
+/**
+ * @brief Tells whether the processor computes CRC-32C in hardware (SSE4.2).
+ */
+bool hasHardwareCrc32c();
+
+/**
+ * @brief The selected function.
+ */
+inline Function selectedFunction = standard;
+
+/**
+ * @brief Returns the function for a StringHashFunction.
+ */
+Function get(StringHashFunction function);
+
+/**
+ * @brief Selects the function used by hash().
+ */
+void select(StringHashFunction function);
+
+/**
+ * @brief Returns the name of a function, as given to `--hash`.
+ */
+std::string name(StringHashFunction function);
+
+/**
+ * @brief Returns the function with the given name.
+ *
+ * @throws std::invalid_argument If no function has that name.
+ */
+StringHashFunction fromName(const std::string &name);
+
+/**
+ * @brief Hashes the bytes with the selected function.
+ */
+inline uint64_t hash(const char *data, size_t length) {
+  return selectedFunction(data, length);
+}
+} // namespace StringHash
+
+#endif
@@ -0,0 +1,133 @@
+#ifndef SLAB_POOL_HPP
+#define SLAB_POOL_HPP
+
+#include <memory>
+#include <vector>
+
+/**
+ * @brief An object pool that carves objects of one type out of large slabs,
+ * instead of allocating each of them on the heap.
+ *
+ * Objects are packed next to each other with no per-allocation header, and a
+ * destroyed object's cell is kept on a free list to be reused by the next
+ * create(). Slabs double in size, from MIN_SLAB_SIZE up to MAX_SLAB_SIZE
+ * objects, and are only given back to the heap by clear() or the destructor.
+ * reserve() adds a single slab as large as needed.
+ *
+ * The pool does not know which of its cells are alive: every object must be
+ * destroyed with destroy() before clear() is called or the pool goes away.
+ *
+ * @tparam T The type of the objects.
+ */
+template <typename T> class SlabPool {
+public:
+  /**
+   * @brief Number of objects of the first slab.
+   */
+  static const size_t MIN_SLAB_SIZE = 64;
+
+  /**
+   * @brief Maximum number of objects of a slab.
+   */
+  static const size_t MAX_SLAB_SIZE = 16384;
+
+private:
+  /**
+   * @brief Raw storage for one object, or the link to the next free cell
+   * while it holds none.
+   */
+  union Cell {
+    Cell *nextFree;
+    alignas(T) unsigned char storage[sizeof(T)];
+  };
+
+  /**
+   * @brief The slabs, each an array of cells.
+   */
+  std::vector<std::unique_ptr<Cell[]>> slabs;
+
+  /**
+   * @brief The number of cells of the last slab.
+   */
+  size_t lastSlabSize;
+
+  /**
+   * @brief The number of cells of the last slab handed out so far.
+   */
+  size_t lastSlabUsed;
+
+  /**
+   * @brief The total number of cells of all slabs.
+   */
+  size_t capacity;
+
+  /**
+   * @brief The number of objects alive.
+   */
+  size_t used;
+
+  /**
+   * @brief The most recently freed cell, or nullptr.
+   */
+  Cell *freeList;
+
+  /**
+   * @brief Returns an unused cell, allocating a new slab if needed.
+   */
+  Cell *allocate();
+
+public:
+  /**
+   * @brief Constructs an empty pool. No slab is allocated until the first
+   * create().
+   */
+  SlabPool();
+
+  SlabPool(const SlabPool &) = delete;
+  SlabPool &operator=(const SlabPool &) = delete;
+
+  /**
+   * @brief Constructs an object in a cell of the pool.
+   *
+   * @param args The arguments forwarded to the constructor of T.
+   * @return T* The new object.
+   */
+  template <typename... Args> T *create(Args &&...args);
+
+  /**
+   * @brief Destroys an object created by this pool and keeps its cell for
+   * reuse.
+   *
+   * @param object The object to destroy.
+   */
+  void destroy(T *object);
+
+  /**
+   * @brief Makes sure that the next `count` objects are created without
+   * allocating, adding one slab for all of them if needed.
+   *
+   * @param count The number of objects to make room for.
+   */
+  void reserve(size_t count);
+
+  /**
+   * @brief Exchanges the slabs, and so the objects, of two pools.
+   *
+   * @param other The pool to swap with.
+   */
+  void swap(SlabPool &other) noexcept;
+
+  /**
+   * @brief Releases every slab. Every object must have been destroyed.
+   */
+  void clear();
+
+  /**
+   * @brief Returns the number of bytes taken by the slabs.
+   */
+  size_t getMemoryUsage() const;
+};
+
+#include "Utils/Memory/SlabPool.impl.hpp"
+
+#endif
@@ -0,0 +1,101 @@
+#include "Utils/Memory/SlabPool.hpp"
+
+#include <new>
+#include <utility>
+
+template <typename T>
+SlabPool<T>::SlabPool()
+    : lastSlabSize(0), lastSlabUsed(0), capacity(0), used(0),
+      freeList(nullptr) {}
+
+template <typename T>
+typename SlabPool<T>::Cell *SlabPool<T>::allocate() {
+  if (freeList) {
+    Cell *cell = freeList;
+    freeList = cell->nextFree;
+    return cell;
+  }
+
+  if (lastSlabUsed == lastSlabSize) {
+    if (lastSlabSize == 0)
+      lastSlabSize = MIN_SLAB_SIZE;
+    else if (2 * lastSlabSize < MAX_SLAB_SIZE)
+      lastSlabSize *= 2;
+    else
+      lastSlabSize = MAX_SLAB_SIZE;
+
+    slabs.emplace_back(new Cell[lastSlabSize]);
+    capacity += lastSlabSize;
+    lastSlabUsed = 0;
+  }
+
+  return &slabs.back()[lastSlabUsed++];
+}
+
+template <typename T>
+template <typename... Args>
+T *SlabPool<T>::create(Args &&...args) {
+  Cell *cell = allocate();
+
+  try {
+    T *object = new (cell->storage) T(std::forward<Args>(args)...);
+    used++;
+    return object;
+  } catch (...) {
+    cell->nextFree = freeList;
+    freeList = cell;
+    throw;
+  }
+}
+
+template <typename T> void SlabPool<T>::destroy(T *object) {
+  object->~T();
+
+  Cell *cell = reinterpret_cast<Cell *>(object);
+  cell->nextFree = freeList;
+  freeList = cell;
+  used--;
+}
+
+template <typename T> void SlabPool<T>::reserve(size_t count) {
+  if (capacity - used >= count)
+    return;
+
+  // The cells left in the last slab go to the free list, so that the new
+  // slab can become the last one.
+  for (; lastSlabUsed < lastSlabSize; lastSlabUsed++) {
+    Cell *cell = &slabs.back()[lastSlabUsed];
+    cell->nextFree = freeList;
+    freeList = cell;
+  }
+
+  size_t missing = count - (capacity - used);
+  size_t size = missing < MIN_SLAB_SIZE ? MIN_SLAB_SIZE : missing;
+  slabs.emplace_back(new Cell[size]);
+  capacity += size;
+  lastSlabSize = size;
+  lastSlabUsed = 0;
+}
+
+template <typename T> void SlabPool<T>::swap(SlabPool &other) noexcept {
+  slabs.swap(other.slabs);
+  std::swap(lastSlabSize, other.lastSlabSize);
+  std::swap(lastSlabUsed, other.lastSlabUsed);
+  std::swap(capacity, other.capacity);
+  std::swap(used, other.used);
+  std::swap(freeList, other.freeList);
+}
+
+template <typename T> void SlabPool<T>::clear() {
+  slabs.clear();
+  lastSlabSize = 0;
+  lastSlabUsed = 0;
+  capacity = 0;
+  used = 0;
+  freeList = nullptr;
+}
+
+template <typename T> size_t SlabPool<T>::getMemoryUsage() const {
+  return sizeof(*this) + slabs.capacity() * sizeof(std::unique_ptr<Cell[]>) +
+         capacity * sizeof(Cell);
+}
@@ -18,6 +18,22 @@ const std::unordered_map<std::string, DictionaryType> stringDictionaryTypeMap =
     {{"dictionary_avl", DictionaryType::AVL},
      {"dictionary_redblack", DictionaryType::RedBlack},
      {"dictionary_chained", DictionaryType::Chained},
-     {"dictionary_open", DictionaryType::OpenAddressing}};
+     {"dictionary_open", DictionaryType::OpenAddressing},
+     {"dictionary_hat", DictionaryType::HATTrie},
+     {"dictionary_tst", DictionaryType::TernarySearch},
+     {"dictionary_skiplist", DictionaryType::ConcurrentSkipList},
+     {"dictionary_splay", DictionaryType::Splay},
+     {"dictionary_treap", DictionaryType::Treap},
+     {"dictionary_countmin", DictionaryType::CountMinSketch},
+     {"dictionary_spacesaving", DictionaryType::SpaceSaving},
+     {"dictionary_sharded_chained", DictionaryType::ShardedChained},
+     {"dictionary_sharded_open", DictionaryType::ShardedOpenAddressing},
+     {"dictionary_lockfree", DictionaryType::LockFree},
+     {"dictionary_extendible", DictionaryType::Extendible},
+     {"dictionary_chained_fastprime", DictionaryType::ChainedFastPrime},
+     {"dictionary_chained_pow2", DictionaryType::ChainedPowerOfTwo},
+     {"dictionary_open_linear", DictionaryType::OpenAddressingLinear},
+     {"dictionary_open_double", DictionaryType::OpenAddressingDouble},
+     {"dictionary_open_simd", DictionaryType::OpenAddressingGroupScan}};
 
 #endif
\ No newline at end of file
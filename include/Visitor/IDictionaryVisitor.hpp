@@ -7,11 +7,50 @@ template <typename Key, typename Value> class AVLTree;
 
 template <typename Key, typename Value> class RedBlackTree;
 
-template <typename Key, typename Value, typename Hash> class ChainedHashTable;
+template <typename Key, typename Value, typename Hash, typename SizingPolicy>
+class ChainedHashTable;
 
-template <typename Key, typename Value, typename Hash>
+template <typename Key, typename Value, typename Hash, typename ProbingPolicy>
 class OpenAddressingHashTable;
 
+template <typename Key, typename Value> class HATTrie;
+
+template <typename Key, typename Value> class TernarySearchTree;
+
+template <typename Key, typename Value> class ConcurrentSkipList;
+
+template <typename Key, typename Value> class SplayTree;
+
+template <typename Key, typename Value> class Treap;
+
+template <typename Key, typename Value, typename Hash> class CountMinSketch;
+
+template <typename Key, typename Value, typename Hash> class SpaceSaving;
+
+template <typename Key, typename Value, typename Hash> class FrozenHashTable;
+
+template <typename Key, typename Value, typename Shard, typename Hash>
+class ConcurrentShardedHashTable;
+
+template <typename Key, typename Value, typename Hash> class LockFreeHashTable;
+
+template <typename Key, typename Value, typename Hash>
+class ExtendibleHashTable;
+
+class PrimeSizing;
+
+class FastPrimeSizing;
+
+class PowerOfTwoSizing;
+
+class LinearProbing;
+
+class QuadraticProbing;
+
+class DoubleHashing;
+
+class GroupScanProbing;
+
 /**
  * @class IDictionaryVisitor
  * @brief An interface (abstract class) for a visitor that collects metrics from
@@ -65,7 +104,8 @@ public:
    * visited.
    */
   virtual void collectMetrics(
-      const ChainedHashTable<Key, Value, Hash> &chainedHashTable) = 0;
+      const ChainedHashTable<Key, Value, Hash, PrimeSizing>
+          &chainedHashTable) = 0;
 
   /**
    * @brief Pure virtual function to visit an OpenAddressingHashTable.
@@ -76,8 +116,216 @@ public:
    * @param openAddressingHashTable A constant reference to the
    * OpenAddressingHashTable to be visited.
    */
-  virtual void collectMetrics(const OpenAddressingHashTable<Key, Value, Hash>
-                                  &openAddressingHashTable) = 0;
+  virtual void collectMetrics(
+      const OpenAddressingHashTable<Key, Value, Hash, QuadraticProbing>
+          &openAddressingHashTable) = 0;
+
+  /**
+   * @brief Pure virtual function to visit a HATTrie.
+   *
+   * A concrete visitor must implement this method to handle metric collection
+   * for a HATTrie.
+   *
+   * @param hatTrie A constant reference to the HATTrie to be visited.
+   */
+  virtual void collectMetrics(const HATTrie<Key, Value> &hatTrie) = 0;
+
+  /**
+   * @brief Pure virtual function to visit a TernarySearchTree.
+   *
+   * A concrete visitor must implement this method to handle metric collection
+   * for a TernarySearchTree.
+   *
+   * @param ternarySearchTree A constant reference to the TernarySearchTree to
+   * be visited.
+   */
+  virtual void
+  collectMetrics(const TernarySearchTree<Key, Value> &ternarySearchTree) = 0;
+
+  /**
+   * @brief Pure virtual function to visit a ConcurrentSkipList.
+   *
+   * A concrete visitor must implement this method to handle metric collection
+   * for a ConcurrentSkipList.
+   *
+   * @param concurrentSkipList A constant reference to the ConcurrentSkipList to
+   * be visited.
+   */
+  virtual void
+  collectMetrics(const ConcurrentSkipList<Key, Value> &concurrentSkipList) = 0;
+
+  /**
+   * @brief Pure virtual function to visit a SplayTree.
+   *
+   * A concrete visitor must implement this method to handle metric collection
+   * for a SplayTree.
+   *
+   * @param splayTree A constant reference to the SplayTree to be visited.
+   */
+  virtual void collectMetrics(const SplayTree<Key, Value> &splayTree) = 0;
+
+  /**
+   * @brief Pure virtual function to visit a Treap.
+   *
+   * A concrete visitor must implement this method to handle metric collection
+   * for a Treap.
+   *
+   * @param treap A constant reference to the Treap to be visited.
+   */
+  virtual void collectMetrics(const Treap<Key, Value> &treap) = 0;
+
+  /**
+   * @brief Pure virtual function to visit a CountMinSketch.
+   *
+   * A concrete visitor must implement this method to handle metric collection
+   * for a CountMinSketch.
+   *
+   * @param countMinSketch A constant reference to the CountMinSketch to be
+   * visited.
+   */
+  virtual void
+  collectMetrics(const CountMinSketch<Key, Value, Hash> &countMinSketch) = 0;
+
+  /**
+   * @brief Pure virtual function to visit a SpaceSaving summary.
+   *
+   * A concrete visitor must implement this method to handle metric collection
+   * for a SpaceSaving summary.
+   *
+   * @param spaceSaving A constant reference to the SpaceSaving summary to be
+   * visited.
+   */
+  virtual void
+  collectMetrics(const SpaceSaving<Key, Value, Hash> &spaceSaving) = 0;
+
+  /**
+   * @brief Pure virtual function to visit a FrozenHashTable.
+   *
+   * A concrete visitor must implement this method to handle metric collection
+   * for a FrozenHashTable.
+   *
+   * @param frozenHashTable A constant reference to the FrozenHashTable to be
+   * visited.
+   */
+  virtual void
+  collectMetrics(const FrozenHashTable<Key, Value, Hash> &frozenHashTable) = 0;
+
+  /**
+   * @brief Pure virtual function to visit a ConcurrentShardedHashTable of
+   * chained shards.
+   *
+   * A concrete visitor must implement this method to handle metric collection
+   * for a ConcurrentShardedHashTable whose shards are ChainedHashTables.
+   *
+   * @param shardedHashTable A constant reference to the
+   * ConcurrentShardedHashTable to be visited.
+   */
+  virtual void collectMetrics(
+      const ConcurrentShardedHashTable<
+          Key, Value, ChainedHashTable<Key, Value, Hash, PrimeSizing>, Hash>
+          &shardedHashTable) = 0;
+
+  /**
+   * @brief Pure virtual function to visit a ConcurrentShardedHashTable of
+   * open addressing shards.
+   *
+   * A concrete visitor must implement this method to handle metric collection
+   * for a ConcurrentShardedHashTable whose shards are
+   * OpenAddressingHashTables.
+   *
+   * @param shardedHashTable A constant reference to the
+   * ConcurrentShardedHashTable to be visited.
+   */
+  virtual void collectMetrics(
+      const ConcurrentShardedHashTable<
+          Key, Value,
+          OpenAddressingHashTable<Key, Value, Hash, QuadraticProbing>, Hash>
+          &shardedHashTable) = 0;
+
+  /**
+   * @brief Pure virtual function to visit a LockFreeHashTable.
+   *
+   * A concrete visitor must implement this method to handle metric collection
+   * for a LockFreeHashTable.
+   *
+   * @param lockFreeHashTable A constant reference to the LockFreeHashTable to
+   * be visited.
+   */
+  virtual void collectMetrics(
+      const LockFreeHashTable<Key, Value, Hash> &lockFreeHashTable) = 0;
+
+  /**
+   * @brief Pure virtual function to visit an ExtendibleHashTable.
+   *
+   * A concrete visitor must implement this method to handle metric collection
+   * for an ExtendibleHashTable.
+   *
+   * @param extendibleHashTable A constant reference to the ExtendibleHashTable
+   * to be visited.
+   */
+  virtual void collectMetrics(
+      const ExtendibleHashTable<Key, Value, Hash> &extendibleHashTable) = 0;
+
+  /**
+   * @brief Pure virtual function to visit a ChainedHashTable with
+   * FastPrimeSizing.
+   *
+   * A concrete visitor must implement this method to handle metric collection
+   * for a ChainedHashTable with FastPrimeSizing.
+   *
+   * @param chainedHashTable A constant reference to the ChainedHashTable to be
+   * visited.
+   */
+  virtual void collectMetrics(
+      const ChainedHashTable<Key, Value, Hash, FastPrimeSizing>
+          &chainedHashTable) = 0;
+
+  /**
+   * @brief Pure virtual function to visit a ChainedHashTable with
+   * PowerOfTwoSizing.
+   *
+   * A concrete visitor must implement this method to handle metric collection
+   * for a ChainedHashTable with PowerOfTwoSizing.
+   *
+   * @param chainedHashTable A constant reference to the ChainedHashTable to be
+   * visited.
+   */
+  virtual void collectMetrics(
+      const ChainedHashTable<Key, Value, Hash, PowerOfTwoSizing>
+          &chainedHashTable) = 0;
+
+  /**
+   * @brief Pure virtual function to visit an OpenAddressingHashTable with
+   * LinearProbing.
+   *
+   * @param openAddressingHashTable A constant reference to the
+   * OpenAddressingHashTable to be visited.
+   */
+  virtual void collectMetrics(
+      const OpenAddressingHashTable<Key, Value, Hash, LinearProbing>
+          &openAddressingHashTable) = 0;
+
+  /**
+   * @brief Pure virtual function to visit an OpenAddressingHashTable with
+   * DoubleHashing.
+   *
+   * @param openAddressingHashTable A constant reference to the
+   * OpenAddressingHashTable to be visited.
+   */
+  virtual void collectMetrics(
+      const OpenAddressingHashTable<Key, Value, Hash, DoubleHashing>
+          &openAddressingHashTable) = 0;
+
+  /**
+   * @brief Pure virtual function to visit an OpenAddressingHashTable with
+   * GroupScanProbing.
+   *
+   * @param openAddressingHashTable A constant reference to the
+   * OpenAddressingHashTable to be visited.
+   */
+  virtual void collectMetrics(
+      const OpenAddressingHashTable<Key, Value, Hash, GroupScanProbing>
+          &openAddressingHashTable) = 0;
 };
 
 #endif
\ No newline at end of file
@@ -2,6 +2,7 @@
 #define REPORT_DATA_VISITOR_HPP
 
 #include <functional>
+#include <vector>
 
 #include "Dictionary/IDictionary.hpp"
 #include "Reports/ReportData.hpp"
@@ -42,6 +43,66 @@ class ReportDataCollectorVisitor : public IDictionaryVisitor<Key, Value> {
    */
   void setDictionaryType(const std::string &dictType);
 
+  /**
+   * @brief Adds the cost of the rehashes of a hash table to the report,
+   * apart from its comparisons and collisions.
+   * @param rehashes The number of rehashes.
+   * @param moves The number of key-value pairs moved by them.
+   */
+  void addRehashMetrics(size_t rehashes, size_t moves);
+
+  /**
+   * @brief Adds the mean, variance and maximum of the chain lengths of a
+   * chained hash table to the report.
+   *
+   * With a hash function that spreads the keys evenly, the lengths follow a
+   * Poisson distribution, whose variance equals its mean; a larger variance
+   * means the function piles keys into some buckets.
+   *
+   * @param histogram The number of buckets with each chain length.
+   */
+  void addChainLengthMetrics(const std::vector<size_t> &histogram);
+
+  /**
+   * @brief Adds the mean and maximum number of probes needed to reach the
+   * keys of an open addressing hash table, and their distribution, to the
+   * report.
+   *
+   * @param histogram The number of keys found by each probe.
+   */
+  void addProbeLengthMetrics(const std::vector<size_t> &histogram);
+
+  /**
+   * @brief Collects the metrics shared by chained hash tables, whatever their
+   * sizing policy: comparisons, collisions and rehashes.
+   *
+   * @param chainedHashTable The table to be analyzed.
+   */
+  template <typename Table>
+  void collectChainedMetrics(const Table &chainedHashTable);
+
+  /**
+   * @brief Collects the metrics shared by open addressing hash tables,
+   * whatever their probing policy: comparisons, collisions, rehashes, the
+   * probes and cache lines per lookup, and the probe lengths of the keys.
+   *
+   * @param openAddressingHashTable The table to be analyzed.
+   */
+  template <typename Table>
+  void collectOpenAddressingMetrics(const Table &openAddressingHashTable);
+
+  /**
+   * @brief Collects the metrics shared by sharded hash tables: the
+   * comparisons, collisions and rehashes of every shard, added together, and
+   * the lock contention.
+   *
+   * @param shardedHashTable The table to be analyzed.
+   */
+  template <typename Shard>
+  void collectShardedMetrics(
+      const ConcurrentShardedHashTable<Key, Value, Shard, Hash>
+          &shardedHashTable);
+
 public:
   /**
    * @brief Constructs a ReportDataCollectorVisitor.
@@ -78,8 +139,8 @@ public:
    *
    * @param chainedHashTable The ChainedHashTable instance to be analyzed.
    */
-  void
-  collectMetrics(const ChainedHashTable<Key, Value, Hash> &chainedHashTable);
+  void collectMetrics(
+      const ChainedHashTable<Key, Value, Hash, PrimeSizing> &chainedHashTable);
 
   /**
    * @brief Collects performance metrics from an OpenAddressingHashTable.
@@ -92,7 +153,203 @@ public:
    * analyzed.
    */
   void collectMetrics(
-      const OpenAddressingHashTable<Key, Value, Hash> &openAddressingHashTable);
+      const OpenAddressingHashTable<Key, Value, Hash, QuadraticProbing>
+          &openAddressingHashTable);
+
+  /**
+   * @brief Collects performance metrics from a HATTrie.
+   *
+   * This method sets the dictionary type to "HATTrie" and records its
+   * comparison count and the number of container bursts in the ReportData
+   * object provided during construction.
+   *
+   * @param hatTrie The HATTrie instance to be analyzed.
+   */
+  void collectMetrics(const HATTrie<Key, Value> &hatTrie);
+
+  /**
+   * @brief Collects performance metrics from a TernarySearchTree.
+   *
+   * This method sets the dictionary type to "TernarySearchTree" and records
+   * its comparison count and number of nodes in the ReportData object provided
+   * during construction.
+   *
+   * @param ternarySearchTree The TernarySearchTree instance to be analyzed.
+   */
+  void collectMetrics(const TernarySearchTree<Key, Value> &ternarySearchTree);
+
+  /**
+   * @brief Collects performance metrics from a ConcurrentSkipList.
+   *
+   * This method sets the dictionary type to "ConcurrentSkipList", records its
+   * comparison count and compare-and-swap failures, and adds one line of
+   * statistics per thread that used the list.
+   *
+   * @param concurrentSkipList The ConcurrentSkipList instance to be analyzed.
+   */
+  void collectMetrics(const ConcurrentSkipList<Key, Value> &concurrentSkipList);
+
+  /**
+   * @brief Collects performance metrics from a SplayTree.
+   *
+   * This method sets the dictionary type to "SplayTree" and records its
+   * comparison count and rotations in the ReportData object provided during
+   * construction.
+   *
+   * @param splayTree The SplayTree instance to be analyzed.
+   */
+  void collectMetrics(const SplayTree<Key, Value> &splayTree);
+
+  /**
+   * @brief Collects performance metrics from a Treap.
+   *
+   * This method sets the dictionary type to "Treap" and records its
+   * comparison count and rotations in the ReportData object provided during
+   * construction.
+   *
+   * @param treap The Treap instance to be analyzed.
+   */
+  void collectMetrics(const Treap<Key, Value> &treap);
+
+  /**
+   * @brief Collects performance metrics from a CountMinSketch.
+   *
+   * This method sets the dictionary type to "CountMinSketch", records its
+   * comparison count, number of heavy hitters and error bounds, and adds the
+   * dimensions of the counter matrix.
+   *
+   * @param countMinSketch The CountMinSketch instance to be analyzed.
+   */
+  void collectMetrics(const CountMinSketch<Key, Value, Hash> &countMinSketch);
+
+  /**
+   * @brief Collects performance metrics from a SpaceSaving summary.
+   *
+   * This method sets the dictionary type to "SpaceSaving", records its
+   * comparison count and evictions, and reports its deterministic error bound:
+   * no count exceeds the true one by more than the smallest monitored count.
+   *
+   * @param spaceSaving The SpaceSaving instance to be analyzed.
+   */
+  void collectMetrics(const SpaceSaving<Key, Value, Hash> &spaceSaving);
+
+  /**
+   * @brief Collects performance metrics from a FrozenHashTable.
+   *
+   * This method sets the dictionary type to "FrozenHashTable", records its
+   * comparison count, the number of levels of its perfect hash and the bits
+   * the perfect hash takes per key.
+   *
+   * @param frozenHashTable The FrozenHashTable instance to be analyzed.
+   */
+  void
+  collectMetrics(const FrozenHashTable<Key, Value, Hash> &frozenHashTable);
+
+  /**
+   * @brief Collects performance metrics from a ConcurrentShardedHashTable of
+   * chained shards.
+   *
+   * Records the comparisons and collisions of every shard, added together,
+   * and the lock contention.
+   *
+   * @param shardedHashTable The ConcurrentShardedHashTable instance to be
+   * analyzed.
+   */
+  void collectMetrics(
+      const ConcurrentShardedHashTable<
+          Key, Value, ChainedHashTable<Key, Value, Hash, PrimeSizing>, Hash>
+          &shardedHashTable);
+
+  /**
+   * @brief Collects performance metrics from a ConcurrentShardedHashTable of
+   * open addressing shards.
+   *
+   * Records the comparisons and collisions of every shard, added together,
+   * and the lock contention.
+   *
+   * @param shardedHashTable The ConcurrentShardedHashTable instance to be
+   * analyzed.
+   */
+  void collectMetrics(
+      const ConcurrentShardedHashTable<
+          Key, Value,
+          OpenAddressingHashTable<Key, Value, Hash, QuadraticProbing>, Hash>
+          &shardedHashTable);
+
+  /**
+   * @brief Collects performance metrics from a LockFreeHashTable.
+   *
+   * This method sets the dictionary type to "LockFreeHashTable", records its
+   * comparison count, its compare-and-swap failures, the number of tables it
+   * grew to and the counters of each thread.
+   *
+   * @param lockFreeHashTable The LockFreeHashTable instance to be analyzed.
+   */
+  void
+  collectMetrics(const LockFreeHashTable<Key, Value, Hash> &lockFreeHashTable);
+
+  /**
+   * @brief Collects performance metrics from an ExtendibleHashTable.
+   *
+   * This method sets the dictionary type to "ExtendibleHashTable", records its
+   * comparison count, its bucket splits, the size of its directory, its
+   * number of buckets and how full they are.
+   *
+   * @param extendibleHashTable The ExtendibleHashTable instance to be analyzed.
+   */
+  void collectMetrics(
+      const ExtendibleHashTable<Key, Value, Hash> &extendibleHashTable);
+
+  /**
+   * @brief Collects performance metrics from a ChainedHashTable with
+   * prime sizes and a division-free modulo.
+   *
+   * @param chainedHashTable The ChainedHashTable instance to be analyzed.
+   */
+  void collectMetrics(const ChainedHashTable<Key, Value, Hash, FastPrimeSizing>
+                          &chainedHashTable);
+
+  /**
+   * @brief Collects performance metrics from a ChainedHashTable with
+   * power-of-two sizes and Fibonacci hashing.
+   *
+   * @param chainedHashTable The ChainedHashTable instance to be analyzed.
+   */
+  void collectMetrics(const ChainedHashTable<Key, Value, Hash, PowerOfTwoSizing>
+                          &chainedHashTable);
+
+  /**
+   * @brief Collects performance metrics from an OpenAddressingHashTable with
+   * linear probing.
+   *
+   * @param openAddressingHashTable The OpenAddressingHashTable instance to be
+   * analyzed.
+   */
+  void collectMetrics(
+      const OpenAddressingHashTable<Key, Value, Hash, LinearProbing>
+          &openAddressingHashTable);
+
+  /**
+   * @brief Collects performance metrics from an OpenAddressingHashTable with
+   * double hashing.
+   *
+   * @param openAddressingHashTable The OpenAddressingHashTable instance to be
+   * analyzed.
+   */
+  void collectMetrics(
+      const OpenAddressingHashTable<Key, Value, Hash, DoubleHashing>
+          &openAddressingHashTable);
+
+  /**
+   * @brief Collects performance metrics from an OpenAddressingHashTable with
+   * linear probing scanned in groups.
+   *
+   * @param openAddressingHashTable The OpenAddressingHashTable instance to be
+   * analyzed.
+   */
+  void collectMetrics(
+      const OpenAddressingHashTable<Key, Value, Hash, GroupScanProbing>
+          &openAddressingHashTable);
 };
 
 #include "Visitor/ReportDataCollectorVisitor.impl.hpp"
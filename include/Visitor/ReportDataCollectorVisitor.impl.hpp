@@ -1,9 +1,22 @@
 #include "Visitor/ReportDataCollectorVisitor.hpp"
 
+#include <cmath>
+
 #include "HashTables/Chained/ChainedHashTable.hpp"
+#include "HashTables/Extendible/ExtendibleHashTable.hpp"
+#include "HashTables/Frozen/FrozenHashTable.hpp"
+#include "HashTables/LockFree/LockFreeHashTable.hpp"
 #include "HashTables/OpenAddressing/OpenAddressingHashTable.hpp"
+#include "HashTables/Sharded/ConcurrentShardedHashTable.hpp"
+#include "Sketches/CountMin/CountMinSketch.hpp"
+#include "Sketches/SpaceSaving/SpaceSaving.hpp"
+#include "SkipLists/Concurrent/ConcurrentSkipList.hpp"
 #include "Trees/AVL/AVLTree.hpp"
 #include "Trees/RedBlack/RedBlackTree.hpp"
+#include "Trees/Splay/SplayTree.hpp"
+#include "Trees/Treap/Treap.hpp"
+#include "Tries/HAT/HATTrie.hpp"
+#include "Tries/Ternary/TernarySearchTree.hpp"
 #include "Utils/Casting/Casting.hpp"
 
 template <typename Key, typename Value, typename Hash>
@@ -18,6 +31,75 @@ void ReportDataCollectorVisitor<Key, Value, Hash>::setDictionaryType(
   report.dictionaryType = dictType;
 }
 
+template <typename Key, typename Value, typename Hash>
+void ReportDataCollectorVisitor<Key, Value, Hash>::addRehashMetrics(
+    size_t rehashes, size_t moves) {
+  report.additionalMetrics.emplace_back("Rehashes", std::to_string(rehashes));
+  report.additionalMetrics.emplace_back("Pares movidos em rehashes",
+                                        std::to_string(moves));
+}
+
+template <typename Key, typename Value, typename Hash>
+void ReportDataCollectorVisitor<Key, Value, Hash>::addChainLengthMetrics(
+    const std::vector<size_t> &histogram) {
+  double buckets = 0, sum = 0, squares = 0;
+
+  for (size_t length = 0; length < histogram.size(); length++) {
+    buckets += histogram[length];
+    sum += static_cast<double>(length) * histogram[length];
+    squares += static_cast<double>(length) * length * histogram[length];
+  }
+
+  double mean = sum / buckets;
+  double variance = squares / buckets - mean * mean;
+
+  report.additionalMetrics.emplace_back(
+      "Comprimento das cadeias (média / variância / máximo)",
+      StringHandler::toString(mean) + " / " +
+          StringHandler::toString(variance) + " / " +
+          std::to_string(histogram.size() - 1));
+}
+
+template <typename Key, typename Value, typename Hash>
+void ReportDataCollectorVisitor<Key, Value, Hash>::addProbeLengthMetrics(
+    const std::vector<size_t> &histogram) {
+  // Probe counts of 4 or more are grouped by powers of two.
+  std::vector<std::pair<size_t, size_t>> groups = {{1, 1}, {2, 2}, {3, 3}};
+  for (size_t first = 4; first <= histogram.size(); first *= 2)
+    groups.emplace_back(first, 2 * first - 1);
+
+  double keys = 0, probes = 0;
+  for (size_t i = 0; i < histogram.size(); i++) {
+    keys += histogram[i];
+    probes += static_cast<double>(i + 1) * histogram[i];
+  }
+
+  std::string distribution;
+  for (const auto &[first, last] : groups) {
+    double count = 0;
+    for (size_t probe = first; probe <= last and probe <= histogram.size();
+         probe++)
+      count += histogram[probe - 1];
+
+    if (!distribution.empty())
+      distribution += ", ";
+    distribution += std::to_string(first);
+    if (last > first)
+      distribution += "-" + std::to_string(last);
+    distribution += ": " +
+                    StringHandler::toString(
+                        std::round(keys ? 1000 * count / keys : 0) / 10) +
+                    "%";
+  }
+
+  report.additionalMetrics.emplace_back(
+      "Sondagens por chave (média / máximo)",
+      StringHandler::toString(keys ? probes / keys : 0) + " / " +
+          std::to_string(histogram.size()));
+  report.additionalMetrics.emplace_back("Distribuição das sondagens",
+                                        distribution);
+}
+
 template <typename Key, typename Value, typename Hash>
 ReportDataCollectorVisitor<Key, Value, Hash>::ReportDataCollectorVisitor(
     ReportData &data)
@@ -44,22 +126,294 @@ void ReportDataCollectorVisitor<Key, Value, Hash>::collectMetrics(
 
 template <typename Key, typename Value, typename Hash>
 void ReportDataCollectorVisitor<Key, Value, Hash>::collectMetrics(
-    const ChainedHashTable<Key, Value, Hash> &chainedHashTable) {
+    const ChainedHashTable<Key, Value, Hash, PrimeSizing> &chainedHashTable) {
   setDictionaryType("Tabela Hash por Encadeamento Exterior");
-  addComparisonsCount(
-      Casting::toIDictionary<Key, Value, ChainedHashTable<Key, Value, Hash>>(
-          chainedHashTable));
-  report.specificMetric = {"colisões", chainedHashTable.getCollisionsCount()};
+  collectChainedMetrics(chainedHashTable);
 }
 
 template <typename Key, typename Value, typename Hash>
 void ReportDataCollectorVisitor<Key, Value, Hash>::collectMetrics(
-    const OpenAddressingHashTable<Key, Value, Hash> &openAddressingHashTable) {
+    const OpenAddressingHashTable<Key, Value, Hash, QuadraticProbing>
+        &openAddressingHashTable) {
   setDictionaryType("Tabela Hash por Endereçamento Aberto");
+  collectOpenAddressingMetrics(openAddressingHashTable);
+}
+
+template <typename Key, typename Value, typename Hash>
+void ReportDataCollectorVisitor<Key, Value, Hash>::collectMetrics(
+    const HATTrie<Key, Value> &hatTrie) {
+  setDictionaryType("HAT-trie");
+  addComparisonsCount(
+      Casting::toIDictionary<Key, Value, HATTrie<Key, Value>>(hatTrie));
+  report.specificMetric = {"estouros", hatTrie.getBurstsCount()};
+}
+
+template <typename Key, typename Value, typename Hash>
+void ReportDataCollectorVisitor<Key, Value, Hash>::collectMetrics(
+    const TernarySearchTree<Key, Value> &ternarySearchTree) {
+  setDictionaryType("Árvore de Busca Ternária");
+  addComparisonsCount(
+      Casting::toIDictionary<Key, Value, TernarySearchTree<Key, Value>>(
+          ternarySearchTree));
+  report.specificMetric = {"nós", ternarySearchTree.getNodesCount()};
+}
+
+template <typename Key, typename Value, typename Hash>
+void ReportDataCollectorVisitor<Key, Value, Hash>::collectMetrics(
+    const ConcurrentSkipList<Key, Value> &concurrentSkipList) {
+  setDictionaryType("Skip List Concorrente (lock-free)");
+  addComparisonsCount(
+      Casting::toIDictionary<Key, Value, ConcurrentSkipList<Key, Value>>(
+          concurrentSkipList));
+  report.specificMetric = {"falhas de CAS",
+                           concurrentSkipList.getCasFailuresCount()};
+
+  size_t thread = 1;
+  for (const auto &stats : concurrentSkipList.getThreadStatistics()) {
+    report.additionalMetrics.emplace_back(
+        "Thread " + std::to_string(thread++),
+        "comparações: " + std::to_string(stats.comparisons) +
+            ", inserções: " + std::to_string(stats.insertions) +
+            ", falhas de CAS: " + std::to_string(stats.casFailures));
+  }
+}
+
+template <typename Key, typename Value, typename Hash>
+void ReportDataCollectorVisitor<Key, Value, Hash>::collectMetrics(
+    const SplayTree<Key, Value> &splayTree) {
+  setDictionaryType("Árvore Splay");
+  addComparisonsCount(
+      Casting::toIDictionary<Key, Value, SplayTree<Key, Value>>(splayTree));
+  report.specificMetric = {"rotações", splayTree.getRotationsCount()};
+}
+
+template <typename Key, typename Value, typename Hash>
+void ReportDataCollectorVisitor<Key, Value, Hash>::collectMetrics(
+    const Treap<Key, Value> &treap) {
+  setDictionaryType("Treap");
   addComparisonsCount(
-      Casting::toIDictionary<Key, Value,
-                             OpenAddressingHashTable<Key, Value, Hash>>(
-          openAddressingHashTable));
+      Casting::toIDictionary<Key, Value, Treap<Key, Value>>(treap));
+  report.specificMetric = {"rotações", treap.getRotationsCount()};
+}
+
+template <typename Key, typename Value, typename Hash>
+void ReportDataCollectorVisitor<Key, Value, Hash>::collectMetrics(
+    const CountMinSketch<Key, Value, Hash> &countMinSketch) {
+  setDictionaryType("Count-Min Sketch (atualização conservadora)");
+  addComparisonsCount(
+      Casting::toIDictionary<Key, Value, CountMinSketch<Key, Value, Hash>>(
+          countMinSketch));
+  report.specificMetric = {"palavras monitoradas",
+                           countMinSketch.getHeavyHittersCount()};
+  report.errorBounds = ErrorBounds{countMinSketch.getEpsilon(),
+                                   countMinSketch.getDelta(),
+                                   countMinSketch.getMaxOverestimate()};
+  report.additionalMetrics.emplace_back(
+      "Contadores (profundidade x largura)",
+      std::to_string(countMinSketch.getDepth()) + " x " +
+          std::to_string(countMinSketch.getWidth()));
+}
+
+template <typename Key, typename Value, typename Hash>
+void ReportDataCollectorVisitor<Key, Value, Hash>::collectMetrics(
+    const SpaceSaving<Key, Value, Hash> &spaceSaving) {
+  setDictionaryType("Space-Saving (top-k)");
+  addComparisonsCount(
+      Casting::toIDictionary<Key, Value, SpaceSaving<Key, Value, Hash>>(
+          spaceSaving));
+  report.specificMetric = {"substituições", spaceSaving.getEvictionsCount()};
+  report.errorBounds = ErrorBounds{1.0 / spaceSaving.getCapacity(), 0.0,
+                                   spaceSaving.getMinimumCount()};
+  report.additionalMetrics.emplace_back(
+      "Contadores", std::to_string(spaceSaving.getCapacity()));
+}
+
+template <typename Key, typename Value, typename Hash>
+void ReportDataCollectorVisitor<Key, Value, Hash>::collectMetrics(
+    const FrozenHashTable<Key, Value, Hash> &frozenHashTable) {
+  setDictionaryType("Tabela Hash Perfeita Congelada");
+  addComparisonsCount(
+      Casting::toIDictionary<Key, Value, FrozenHashTable<Key, Value, Hash>>(
+          frozenHashTable));
+  report.specificMetric = {"níveis", frozenHashTable.getLevelsCount()};
+  report.additionalMetrics.emplace_back(
+      "Bits por chave (hash perfeito)",
+      StringHandler::toString(frozenHashTable.getBitsPerKey()));
+  report.additionalMetrics.emplace_back(
+      "Chaves com código de hash repetido",
+      std::to_string(frozenHashTable.getSharedCodesCount()));
+}
+
+template <typename Key, typename Value, typename Hash>
+template <typename Table>
+void ReportDataCollectorVisitor<Key, Value, Hash>::collectChainedMetrics(
+    const Table &chainedHashTable) {
+  addComparisonsCount(
+      Casting::toIDictionary<Key, Value, Table>(chainedHashTable));
+  report.specificMetric = {"colisões", chainedHashTable.getCollisionsCount()};
+  addRehashMetrics(chainedHashTable.getRehashesCount(),
+                   chainedHashTable.getRehashMovesCount());
+  addChainLengthMetrics(chainedHashTable.getChainLengthHistogram());
+}
+
+template <typename Key, typename Value, typename Hash>
+template <typename Table>
+void ReportDataCollectorVisitor<Key, Value, Hash>::collectOpenAddressingMetrics(
+    const Table &openAddressingHashTable) {
+  addComparisonsCount(
+      Casting::toIDictionary<Key, Value, Table>(openAddressingHashTable));
   report.specificMetric = {"colisões",
                            openAddressingHashTable.getCollisionsCount()};
+  addRehashMetrics(openAddressingHashTable.getRehashesCount(),
+                   openAddressingHashTable.getRehashMovesCount());
+
+  report.probeStatistics = ProbeStatistics{
+      openAddressingHashTable.getLookupsCount(),
+      openAddressingHashTable.getProbesCount(),
+      openAddressingHashTable.getCacheLinesCount()};
+
+  addProbeLengthMetrics(openAddressingHashTable.getProbeLengthHistogram());
+}
+
+template <typename Key, typename Value, typename Hash>
+template <typename Shard>
+void ReportDataCollectorVisitor<Key, Value, Hash>::collectShardedMetrics(
+    const ConcurrentShardedHashTable<Key, Value, Shard, Hash>
+        &shardedHashTable) {
+  size_t comparisons = 0, collisions = 0, rehashes = 0, rehashMoves = 0;
+
+  for (size_t i = 0; i < shardedHashTable.getShardsCount(); i++) {
+    const Shard &shard = shardedHashTable.getShard(i);
+    comparisons += Casting::toIDictionary<Key, Value, Shard>(shard)
+                       .getComparisonsCount();
+    collisions += shard.getCollisionsCount();
+    rehashes += shard.getRehashesCount();
+    rehashMoves += shard.getRehashMovesCount();
+  }
+
+  auto locks = shardedHashTable.getLockStatistics();
+
+  report.comparisons = comparisons;
+  report.specificMetric = {"colisões", collisions};
+  report.lockContention = LockContention{
+      locks.acquisitions, locks.contendedAcquisitions, locks.waitTime};
+  addRehashMetrics(rehashes, rehashMoves);
+  report.additionalMetrics.emplace_back(
+      "Shards", std::to_string(shardedHashTable.getShardsCount()));
+}
+
+template <typename Key, typename Value, typename Hash>
+void ReportDataCollectorVisitor<Key, Value, Hash>::collectMetrics(
+    const ConcurrentShardedHashTable<
+        Key, Value, ChainedHashTable<Key, Value, Hash, PrimeSizing>, Hash>
+        &shardedHashTable) {
+  setDictionaryType("Tabela Hash Concorrente Particionada (encadeamento)");
+  collectShardedMetrics(shardedHashTable);
+}
+
+template <typename Key, typename Value, typename Hash>
+void ReportDataCollectorVisitor<Key, Value, Hash>::collectMetrics(
+    const ConcurrentShardedHashTable<
+        Key, Value,
+        OpenAddressingHashTable<Key, Value, Hash, QuadraticProbing>, Hash>
+        &shardedHashTable) {
+  setDictionaryType(
+      "Tabela Hash Concorrente Particionada (endereçamento aberto)");
+  collectShardedMetrics(shardedHashTable);
+}
+
+template <typename Key, typename Value, typename Hash>
+void ReportDataCollectorVisitor<Key, Value, Hash>::collectMetrics(
+    const LockFreeHashTable<Key, Value, Hash> &lockFreeHashTable) {
+  setDictionaryType("Tabela Hash Lock-free (sondagem linear)");
+  addComparisonsCount(
+      Casting::toIDictionary<Key, Value, LockFreeHashTable<Key, Value, Hash>>(
+          lockFreeHashTable));
+  report.specificMetric = {"falhas de CAS",
+                           lockFreeHashTable.getCasFailuresCount()};
+  report.additionalMetrics.emplace_back(
+      "Tabelas", std::to_string(lockFreeHashTable.getTablesCount()));
+  report.additionalMetrics.emplace_back(
+      "Fator de carga",
+      StringHandler::toString(static_cast<float>(lockFreeHashTable.size()) /
+                              lockFreeHashTable.getCapacity()));
+
+  size_t thread = 1;
+  for (const auto &stats : lockFreeHashTable.getThreadStatistics()) {
+    report.additionalMetrics.emplace_back(
+        "Thread " + std::to_string(thread++),
+        "comparações: " + std::to_string(stats.comparisons) +
+            ", inserções: " + std::to_string(stats.insertions) +
+            ", falhas de CAS: " + std::to_string(stats.casFailures));
+  }
+}
+
+template <typename Key, typename Value, typename Hash>
+void ReportDataCollectorVisitor<Key, Value, Hash>::collectMetrics(
+    const ExtendibleHashTable<Key, Value, Hash> &extendibleHashTable) {
+  setDictionaryType("Tabela Hash Extensível");
+  addComparisonsCount(
+      Casting::toIDictionary<Key, Value, ExtendibleHashTable<Key, Value, Hash>>(
+          extendibleHashTable));
+  report.specificMetric = {"divisões de buckets",
+                           extendibleHashTable.getSplitsCount()};
+  report.additionalMetrics.emplace_back(
+      "Tamanho do diretório",
+      std::to_string(extendibleHashTable.getDirectorySize()) +
+          " (profundidade " +
+          std::to_string(extendibleHashTable.getGlobalDepth()) + ")");
+  report.additionalMetrics.emplace_back(
+      "Duplicações do diretório",
+      std::to_string(extendibleHashTable.getDoublingsCount()));
+  report.additionalMetrics.emplace_back(
+      "Buckets", std::to_string(extendibleHashTable.getBucketsCount()));
+  report.additionalMetrics.emplace_back(
+      "Fator de carga",
+      StringHandler::toString(
+          static_cast<float>(extendibleHashTable.size()) /
+          (extendibleHashTable.getBucketsCount() *
+           extendibleHashTable.getBucketCapacity())));
+}
+
+template <typename Key, typename Value, typename Hash>
+void ReportDataCollectorVisitor<Key, Value, Hash>::collectMetrics(
+    const ChainedHashTable<Key, Value, Hash, FastPrimeSizing>
+        &chainedHashTable) {
+  setDictionaryType(
+      "Tabela Hash por Encadeamento Exterior (primos, módulo rápido)");
+  collectChainedMetrics(chainedHashTable);
+}
+
+template <typename Key, typename Value, typename Hash>
+void ReportDataCollectorVisitor<Key, Value, Hash>::collectMetrics(
+    const ChainedHashTable<Key, Value, Hash, PowerOfTwoSizing>
+        &chainedHashTable) {
+  setDictionaryType(
+      "Tabela Hash por Encadeamento Exterior (potências de 2, Fibonacci)");
+  collectChainedMetrics(chainedHashTable);
+}
+
+template <typename Key, typename Value, typename Hash>
+void ReportDataCollectorVisitor<Key, Value, Hash>::collectMetrics(
+    const OpenAddressingHashTable<Key, Value, Hash, LinearProbing>
+        &openAddressingHashTable) {
+  setDictionaryType("Tabela Hash por Endereçamento Aberto (sondagem linear)");
+  collectOpenAddressingMetrics(openAddressingHashTable);
+}
+
+template <typename Key, typename Value, typename Hash>
+void ReportDataCollectorVisitor<Key, Value, Hash>::collectMetrics(
+    const OpenAddressingHashTable<Key, Value, Hash, DoubleHashing>
+        &openAddressingHashTable) {
+  setDictionaryType("Tabela Hash por Endereçamento Aberto (hash duplo)");
+  collectOpenAddressingMetrics(openAddressingHashTable);
+}
+
+template <typename Key, typename Value, typename Hash>
+void ReportDataCollectorVisitor<Key, Value, Hash>::collectMetrics(
+    const OpenAddressingHashTable<Key, Value, Hash, GroupScanProbing>
+        &openAddressingHashTable) {
+  setDictionaryType(
+      "Tabela Hash por Endereçamento Aberto (sondagem linear em grupos SIMD)");
+  collectOpenAddressingMetrics(openAddressingHashTable);
 }
\ No newline at end of file
@@ -0,0 +1,13 @@
+#ifndef COUNTING_ENGINE_HPP
+#define COUNTING_ENGINE_HPP
+
+/**
+ * @brief Defines how the words are counted into the dictionary.
+ *
+ * - Upsert: every word is incremented in the dictionary as it is read.
+ * - Sort: the words are counted by sorting (see SortCounter), and each distinct
+ *   word is added to the dictionary once, with its count.
+ */
+enum class CountingEngine { Upsert, Sort };
+
+#endif
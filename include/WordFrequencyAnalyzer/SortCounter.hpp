@@ -0,0 +1,81 @@
+#ifndef SORT_COUNTER_HPP
+#define SORT_COUNTER_HPP
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/**
+ * @class SortCounter
+ * @brief Counts words by sorting them instead of looking each one up.
+ *
+ * The words are taken in blocks. Each block is sorted with an MSD radix sort
+ * over the bytes of the words, and equal neighbours are collapsed into
+ * (word, count) pairs, giving one sorted run per block. The runs are then
+ * merged pairwise, adding the counts of words found in both, until one is
+ * left.
+ *
+ * The words are ordered by their bytes, not by the locale, so the result
+ * must be inserted into a dictionary to be ordered lexically. The runs
+ * refer to the original words, which must outlive them.
+ */
+class SortCounter {
+public:
+  /**
+   * @brief A sorted sequence of distinct words with their counts.
+   */
+  using Run = std::vector<std::pair<std::string_view, size_t>>;
+
+  /**
+   * @brief Default number of words sorted at a time.
+   */
+  static const size_t DEFAULT_BLOCK_SIZE = 1 << 16;
+
+private:
+  /**
+   * @brief Ranges smaller than this are sorted by insertion.
+   */
+  static const size_t INSERTION_THRESHOLD = 32;
+
+  /**
+   * @brief Returns the radix digit of a word at a given position: one plus
+   * its byte there, or zero past its end, so shorter words come first.
+   */
+  static size_t digit(std::string_view word, size_t depth);
+
+  /**
+   * @brief Sorts the words of a range sharing their first `depth` bytes.
+   *
+   * @param words The first word of the range.
+   * @param buffer Scratch space for as many words as the range holds.
+   * @param n The number of words in the range.
+   * @param depth The number of leading bytes shared by every word.
+   */
+  static void radixSort(std::string_view *words, std::string_view *buffer,
+                        size_t n, size_t depth);
+
+  /**
+   * @brief Collapses a sorted block into a run.
+   */
+  static Run encode(const std::vector<std::string_view> &sorted);
+
+  /**
+   * @brief Merges two runs, adding the counts of the words in both.
+   */
+  static Run merge(const Run &a, const Run &b);
+
+public:
+  /**
+   * @brief Counts the occurrences of every word.
+   *
+   * @param words The words to count.
+   * @param blockSize The number of words sorted at a time.
+   * @return Run The distinct words in byte order, each with its count.
+   * @throws std::invalid_argument If `blockSize` is zero.
+   */
+  static Run count(const std::vector<std::string> &words,
+                   size_t blockSize = DEFAULT_BLOCK_SIZE);
+};
+
+#endif
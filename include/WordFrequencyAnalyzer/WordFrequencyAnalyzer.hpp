@@ -1,15 +1,28 @@
 #ifndef WORD_FREQUENCY_ANALYZER_HPP
 #define WORD_FREQUENCY_ANALYZER_HPP
 
+#include <chrono>
 #include <memory>
+#include <optional>
+#include <utility>
 #include <vector>
 
 #include "Dictionary/IDictionary.hpp"
+#include "Factory/DictionaryType.hpp"
+#include "WordFrequencyAnalyzer/CountingEngine.hpp"
 #include "FileProcessor/FileProcessor.hpp"
 #include "Reports/ReportData.hpp"
 #include "LexicalStr/LexicalStr.hpp"
+#include "Utils/Hashing/StringHash.hpp"
 
 class WordFrequencyAnalyzer {
+  /**
+   * @brief Returns the metrics a dictionary reports, among them its
+   * comparisons, its specific metric and its probe statistics.
+   */
+  static ReportData
+  countersOf(const IDictionary<LexicalStr, size_t> *dictionary);
+
 public:
   /**
    * @brief Analyzes the frequency of words in the provided list and generates a
@@ -19,15 +32,79 @@ public:
    * using the provided dictionary, and returns a report containing the
    * frequency analysis results.
    *
+   * When more than one thread is requested and the dictionary is thread-safe,
+   * the words are split into contiguous slices and every thread counts its
+   * slice directly into the shared dictionary through
+   * IDictionary::increment(). If the dictionary is not thread-safe but its
+   * type is given, every other thread counts its slice into a dictionary of
+   * its own, created by DictionaryFactory, and the dictionaries are then
+   * merged pairwise, level by level, into `dictionary`; the report keeps the
+   * counters of the threads and those of the merge apart. Otherwise the
+   * words are counted sequentially, also through increment(), which
+   * approximate dictionaries support even though they cannot hand out a
+   * reference to a value.
+   *
+   * With the sort engine, the words are first counted by SortCounter and each
+   * distinct word is then incremented once by its count, so the dictionary
+   * sees one operation per distinct word. The threads are not used.
+   *
    * @param dictionary A unique pointer to an IDictionary instance used to store
    * and count word frequencies.
    * @param words A constant reference to a vector of strings representing the
    * words to be analyzed.
+   * @param threads The number of threads used to count the words.
+   * @param engine How the words are counted into the dictionary.
+   * @param dictType The type of `dictionary`, needed to count into
+   * thread-local dictionaries. Sketches are never counted that way, since
+   * they only keep the counts of their heavy hitters.
+   * @param measureLatency Whether to time every operation of a sequential
+   * count and add the longest one to the report's additional metrics. The
+   * clock reads are included in the total time.
    * @return ReportData An object containing the results of the word frequency
    * analysis.
    */
   static ReportData analyze(IDictionary<LexicalStr, size_t> *dictionary,
-                            const FileProcessor &fileProcessor);
+                            const FileProcessor &fileProcessor,
+                            size_t threads = 1,
+                            CountingEngine engine = CountingEngine::Upsert,
+                            std::optional<DictionaryType> dictType =
+                                std::nullopt,
+                            bool measureLatency = false);
+
+  /**
+   * @brief Freezes a counted dictionary into a read-only FrozenHashTable.
+   *
+   * The time taken, the size of the frozen table and the bits its perfect
+   * hash takes per key are added to the report's additional metrics.
+   *
+   * @param dictionary The dictionary to freeze.
+   * @param report The report of the dictionary.
+   * @return std::unique_ptr<IDictionary<LexicalStr, size_t>> The frozen
+   * table, holding the same keys and values.
+   */
+  static std::unique_ptr<IDictionary<LexicalStr, size_t>>
+  freeze(const IDictionary<LexicalStr, size_t> *dictionary,
+         ReportData &report);
+
+  /**
+   * @brief Times a hash function over the words read, apart from any
+   * dictionary.
+   *
+   * Every word is hashed, pass after pass, for at least MIN_HASHING_TIME,
+   * and the name of the function and the mean time per hash are added to the
+   * report's additional metrics.
+   *
+   * @param fileProcessor The words to hash.
+   * @param function The hash function to time.
+   * @param report The report of the run.
+   */
+  static void measureHashing(const FileProcessor &fileProcessor,
+                             StringHashFunction function, ReportData &report);
+
+  /**
+   * @brief The minimum time spent hashing by measureHashing().
+   */
+  static constexpr std::chrono::milliseconds MIN_HASHING_TIME{100};
 };
 
 #endif
\ No newline at end of file
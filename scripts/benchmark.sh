@@ -0,0 +1,48 @@
+#!/usr/bin/env bash
+# Compara o tempo de contagem das estruturas com os motores upsert e sort.
+#
+# Uso: scripts/benchmark.sh [arquivo.txt] [repetições]
+# O arquivo é lido de input/ e o executável freq deve estar compilado.
+# Cada tempo é a mediana das repetições, em milissegundos.
+
+set -euo pipefail
+
+cd "$(dirname "$0")/.."
+
+FILE=${1:-crime_and_punishment.txt}
+RUNS=${2:-5}
+STRUCTURES=(dictionary_avl dictionary_redblack dictionary_chained
+            dictionary_open)
+ENGINES=(upsert sort)
+
+if [ ! -x ./freq ]; then
+  echo "Compile o projeto com make antes de executar o benchmark." >&2
+  exit 1
+fi
+
+median() {
+  sort -n | awk '{ t[NR] = $1 } END { print t[int((NR + 1) / 2)] }'
+}
+
+printf "%-22s" "estrutura"
+for engine in "${ENGINES[@]}"; do
+  printf "%10s" "$engine"
+done
+printf "\n"
+
+for structure in "${STRUCTURES[@]}"; do
+  printf "%-22s" "$structure"
+
+  for engine in "${ENGINES[@]}"; do
+    times=()
+
+    for ((i = 0; i < RUNS; i++)); do
+      ./freq "$structure" "$FILE" --engine="$engine" > /dev/null
+      times+=("$(sed -n 's/^Tempo total (ms): //p' "output/$FILE")")
+    done
+
+    printf "%10s" "$(printf "%s\n" "${times[@]}" | median)"
+  done
+
+  printf "\n"
+done
@@ -0,0 +1,71 @@
+#!/usr/bin/env bash
+# Compara as funções de hash sobre cada texto de input/.
+#
+# Uso: scripts/hashing.sh [repetições]
+# Para cada texto e cada função (--hash), conta as palavras com as tabelas
+# por encadeamento e por endereçamento aberto e mostra: o tempo por hash
+# (medido à parte, sobre todas as palavras do texto), a média e a variância
+# do comprimento das cadeias (iguais, se a função espalha as chaves de modo
+# uniforme), a média de sondagens por chave e a distribuição das sondagens.
+# Os tempos de contagem são a mediana das repetições, em milissegundos. O
+# executável freq deve estar compilado.
+
+set -euo pipefail
+
+cd "$(dirname "$0")/.."
+
+RUNS=${1:-3}
+CORPORA=(a_riqueza_das_nacoes_english.txt crime_and_punishment.txt
+         dom-casmurro.txt sherlock_holmes.txt the-secret-garden.txt)
+HASHES=(std wyhash xxh3 crc32c)
+
+if [ ! -x ./freq ]; then
+  echo "Compile o projeto com make antes de executar o benchmark." >&2
+  exit 1
+fi
+
+median() {
+  sort -n | awk '{ t[NR] = $1 } END { print t[int((NR + 1) / 2)] }'
+}
+
+metric() {
+  sed -n "s|^$1: ||p" "output/$2"
+}
+
+for corpus in "${CORPORA[@]}"; do
+  echo "$corpus"
+  printf "%-8s%10s%14s%14s%27s%24s\n" "hash" "ns/hash" "encad. (ms)" \
+         "aberto (ms)" "cadeias (méd/var/máx)" "sondagens (méd/máx)"
+
+  for hash in "${HASHES[@]}"; do
+    chained=() open=() nanoseconds=()
+
+    for ((i = 0; i < RUNS; i++)); do
+      ./freq dictionary_chained "$corpus" --hash="$hash" > /dev/null
+      chained+=("$(metric "Tempo total (ms)" "$corpus")")
+      nanoseconds+=("$(metric "Tempo por hash (ns)" "$corpus")")
+
+      ./freq dictionary_open "$corpus" --hash="$hash" > /dev/null
+      open+=("$(metric "Tempo total (ms)" "$corpus")")
+      nanoseconds+=("$(metric "Tempo por hash (ns)" "$corpus")")
+    done
+
+    # The chain lengths and probe counts do not change between runs.
+    ./freq dictionary_chained "$corpus" --hash="$hash" > /dev/null
+    chains=$(metric "Comprimento das cadeias (média \/ variância \/ máximo)" \
+                    "$corpus" |
+             awk -F ' / ' '{ printf "%.3f/%.3f/%d", $1, $2, $3 }')
+    ./freq dictionary_open "$corpus" --hash="$hash" > /dev/null
+    probes=$(metric "Sondagens por chave (média \/ máximo)" "$corpus" |
+             awk -F ' / ' '{ printf "%.3f/%d", $1, $2 }')
+    distribution=$(metric "Distribuição das sondagens" "$corpus")
+
+    printf "%-8s%10.2f%14s%14s%24s%22s\n" "$hash" \
+           "$(printf "%s\n" "${nanoseconds[@]}" | median)" \
+           "$(printf "%s\n" "${chained[@]}" | median)" \
+           "$(printf "%s\n" "${open[@]}" | median)" "$chains" "$probes"
+    printf "%8s%s\n" "" "sondagens: $distribution"
+  done
+
+  echo
+done
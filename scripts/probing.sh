@@ -0,0 +1,64 @@
+#!/usr/bin/env bash
+# Compara as sequências de sondagem da tabela hash por endereçamento aberto.
+#
+# Uso: scripts/probing.sh [tamanho em MB] [repetições]
+# Os textos de input/ são concatenados repetidamente até o tamanho pedido, e
+# cada variante conta o texto resultante com uma thread. Cada tempo é a
+# mediana das repetições, em milissegundos. As sondagens e as linhas de cache
+# são médias por busca; as linhas de cache são uma estimativa das falhas de
+# cache, não uma medida do processador. O executável freq deve estar
+# compilado.
+
+set -euo pipefail
+
+cd "$(dirname "$0")/.."
+
+SIZE_MB=${1:-64}
+RUNS=${2:-5}
+CORPORA=(a_riqueza_das_nacoes_english.txt crime_and_punishment.txt
+         dom-casmurro.txt sherlock_holmes.txt the-secret-garden.txt)
+STRUCTURES=(dictionary_open dictionary_open_linear dictionary_open_double
+            dictionary_open_simd)
+FILE="probing_${SIZE_MB}mb.txt"
+
+if [ ! -x ./freq ]; then
+  echo "Compile o projeto com make antes de executar o benchmark." >&2
+  exit 1
+fi
+
+trap 'rm -f "input/$FILE" "output/$FILE"' EXIT
+
+: > "input/$FILE"
+while [ "$(stat -c %s "input/$FILE")" -lt $((SIZE_MB * 1024 * 1024)) ]; do
+  for corpus in "${CORPORA[@]}"; do
+    cat "input/$corpus" >> "input/$FILE"
+  done
+done
+
+median() {
+  sort -n | awk '{ t[NR] = $1 } END { print t[int((NR + 1) / 2)] }'
+}
+
+metric() {
+  sed -n "s|^$1: ||p" "output/$FILE"
+}
+
+printf "%-26s%12s%18s%18s%26s\n" "estrutura" "tempo (ms)" \
+       "sondagens/busca" "linhas/busca" "sondagens/chave (máx)"
+
+for structure in "${STRUCTURES[@]}"; do
+  times=()
+
+  for ((i = 0; i < RUNS; i++)); do
+    ./freq "$structure" "$FILE" > /dev/null
+    times+=("$(metric "Tempo total (ms)")")
+  done
+
+  # The probe counts do not change between runs: the last report is used.
+  printf "%-26s%12s%18.3f%18.3f%26s\n" "$structure" \
+         "$(printf "%s\n" "${times[@]}" | median)" \
+         "$(metric "Sondagens por busca")" \
+         "$(metric "Linhas de cache por busca (estimativa de falhas)")" \
+         "$(metric "Sondagens por chave (média \/ máximo)" |
+            awk -F ' / ' '{ printf "%.3f (%d)", $1, $2 }')"
+done
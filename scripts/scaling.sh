@@ -0,0 +1,69 @@
+#!/usr/bin/env bash
+# Mede como as estruturas concorrentes escalam com o número de threads.
+#
+# Uso: scripts/scaling.sh [tamanho em MB] [repetições]
+# Os textos de input/ são concatenados repetidamente até o tamanho pedido,
+# e cada estrutura conta o texto resultante com 1 a 64 threads, sem passar
+# do limite do freq (4 por thread do processador). Cada tempo é a mediana
+# das repetições, em milissegundos. O executável freq deve estar
+# compilado. Todas as palavras ficam em memória: 1 GB de texto ocupa cerca
+# de 10 GB.
+
+set -euo pipefail
+
+cd "$(dirname "$0")/.."
+
+SIZE_MB=${1:-1024}
+RUNS=${2:-3}
+CORPORA=(a_riqueza_das_nacoes_english.txt crime_and_punishment.txt
+         dom-casmurro.txt sherlock_holmes.txt the-secret-garden.txt)
+STRUCTURES=(dictionary_lockfree dictionary_sharded_open
+            dictionary_sharded_chained)
+THREADS=()
+for threads in 1 2 4 8 16 32 64; do
+  if [ "$threads" -le $(($(nproc) * 4)) ]; then
+    THREADS+=("$threads")
+  fi
+done
+FILE="scaling_${SIZE_MB}mb.txt"
+
+if [ ! -x ./freq ]; then
+  echo "Compile o projeto com make antes de executar o benchmark." >&2
+  exit 1
+fi
+
+trap 'rm -f "input/$FILE" "output/$FILE"' EXIT
+
+: > "input/$FILE"
+while [ "$(stat -c %s "input/$FILE")" -lt $((SIZE_MB * 1024 * 1024)) ]; do
+  for corpus in "${CORPORA[@]}"; do
+    cat "input/$corpus" >> "input/$FILE"
+  done
+done
+
+median() {
+  sort -n | awk '{ t[NR] = $1 } END { print t[int((NR + 1) / 2)] }'
+}
+
+printf "%-28s" "estrutura"
+for threads in "${THREADS[@]}"; do
+  printf "%8s" "$threads"
+done
+printf "\n"
+
+for structure in "${STRUCTURES[@]}"; do
+  printf "%-28s" "$structure"
+
+  for threads in "${THREADS[@]}"; do
+    times=()
+
+    for ((i = 0; i < RUNS; i++)); do
+      ./freq "$structure" "$FILE" --threads="$threads" > /dev/null
+      times+=("$(sed -n 's/^Tempo total (ms): //p' "output/$FILE")")
+    done
+
+    printf "%8s" "$(printf "%s\n" "${times[@]}" | median)"
+  done
+
+  printf "\n"
+done
@@ -0,0 +1,56 @@
+#!/usr/bin/env bash
+# Compara as políticas de dimensionamento da tabela hash por encadeamento.
+#
+# Uso: scripts/sizing.sh [tamanho em MB] [repetições]
+# Os textos de input/ são concatenados repetidamente até o tamanho pedido, e
+# cada variante conta o texto resultante com uma thread. Cada tempo é a
+# mediana das repetições, em milissegundos, e a vazão é o número de palavras
+# lidas (uma busca cada) por microssegundo. O executável freq deve estar
+# compilado.
+
+set -euo pipefail
+
+cd "$(dirname "$0")/.."
+
+SIZE_MB=${1:-64}
+RUNS=${2:-5}
+CORPORA=(a_riqueza_das_nacoes_english.txt crime_and_punishment.txt
+         dom-casmurro.txt sherlock_holmes.txt the-secret-garden.txt)
+STRUCTURES=(dictionary_chained dictionary_chained_fastprime
+            dictionary_chained_pow2)
+FILE="sizing_${SIZE_MB}mb.txt"
+
+if [ ! -x ./freq ]; then
+  echo "Compile o projeto com make antes de executar o benchmark." >&2
+  exit 1
+fi
+
+trap 'rm -f "input/$FILE" "output/$FILE"' EXIT
+
+: > "input/$FILE"
+while [ "$(stat -c %s "input/$FILE")" -lt $((SIZE_MB * 1024 * 1024)) ]; do
+  for corpus in "${CORPORA[@]}"; do
+    cat "input/$corpus" >> "input/$FILE"
+  done
+done
+
+WORDS=$(wc -w < "input/$FILE")
+
+median() {
+  sort -n | awk '{ t[NR] = $1 } END { print t[int((NR + 1) / 2)] }'
+}
+
+printf "%-32s%12s%16s\n" "estrutura" "tempo (ms)" "palavras/us"
+
+for structure in "${STRUCTURES[@]}"; do
+  times=()
+
+  for ((i = 0; i < RUNS; i++)); do
+    ./freq "$structure" "$FILE" > /dev/null
+    times+=("$(sed -n 's/^Tempo total (ms): //p' "output/$FILE")")
+  done
+
+  time=$(printf "%s\n" "${times[@]}" | median)
+  rate=$(awk -v w="$WORDS" -v t="$time" 'BEGIN { printf "%.1f", w / t / 1000 }')
+  printf "%-32s%12s%16s\n" "$structure" "$time" "$rate"
+done
@@ -1,6 +1,9 @@
 #include "CLI/CLIHandler.hpp"
 
+#include <algorithm>
+#include <cctype>
 #include <fstream>
+#include <thread>
 
 #include "Configs/Path.hpp"
 #include "Factory/DictionaryFactory.hpp"
@@ -16,6 +19,70 @@ CLIHandler::CLIHandler(int argc, char **argv) {
     options.filename = argv[2];
     options.inputDict = argv[1];
   }
+
+  for (int i = 3; i < argc; i++)
+    optionalArguments.emplace_back(argv[i]);
+}
+
+size_t CLIHandler::maxThreads() {
+  // hardware_concurrency() is zero when the count is unknown.
+  return THREADS_PER_CORE *
+         std::max<size_t>(std::thread::hardware_concurrency(), 1);
+}
+
+bool CLIHandler::parseOptionalArgument(const std::string &argument) {
+  size_t separator = argument.find('=');
+
+  if (argument == "--freeze") {
+    options.freeze = true;
+    return true;
+  }
+
+  if (argument == "--latency") {
+    options.latency = true;
+    return true;
+  }
+
+  if (separator == std::string::npos)
+    return false;
+
+  std::string name = argument.substr(0, separator),
+              value = argument.substr(separator + 1);
+
+  try {
+    if (name == "--threads") {
+      // std::stoul accepts signs, spaces and trailing characters.
+      if (value.empty() or
+          !std::all_of(value.begin(), value.end(),
+                       [](unsigned char c) { return std::isdigit(c); }))
+        return false;
+
+      size_t end;
+      options.threads = std::stoul(value, &end);
+      return end == value.size() and options.threads > 0 and
+             options.threads <= maxThreads();
+    }
+
+    if (name == "--engine") {
+      if (value == "upsert")
+        options.engine = CountingEngine::Upsert;
+      else if (value == "sort")
+        options.engine = CountingEngine::Sort;
+      else
+        return false;
+
+      return true;
+    }
+
+    if (name == "--hash") {
+      options.hash = StringHash::fromName(value);
+      return true;
+    }
+  } catch (const std::exception &e) {
+    return false;
+  }
+
+  return false;
 }
 
 bool CLIHandler::validOptions() {
@@ -24,6 +91,11 @@ bool CLIHandler::validOptions() {
       return false;
 
     options.dictType = Casting::toDictionaryType(options.inputDict);
+
+    for (const std::string &argument : optionalArguments)
+      if (!parseOptionalArgument(argument))
+        return false;
+
     return true;
   } catch (const DictionaryTypeNotFoundException &e) {
     return false;
@@ -32,13 +104,26 @@ bool CLIHandler::validOptions() {
 
 int CLIHandler::execute() {
   try {
+    if (options.hash)
+      StringHash::select(*options.hash);
+
     FileProcessor fp(options.filename);
 
     std::ofstream outFile(outputPath + options.filename);
     std::unique_ptr<IDictionary<LexicalStr, size_t>> dict =
-        DictionaryFactory<LexicalStr, size_t>::createDictionary(options.dictType);
+        DictionaryFactory<LexicalStr, size_t>::createDictionary(
+            options.dictType, fp.vocabulary.upperBound());
+
+    ReportData report =
+        WordFrequencyAnalyzer::analyze(dict.get(), fp, options.threads,
+                                       options.engine, options.dictType,
+                                       options.latency);
+
+    if (options.hash)
+      WordFrequencyAnalyzer::measureHashing(fp, *options.hash, report);
 
-    ReportData report = WordFrequencyAnalyzer::analyze(dict.get(), fp);
+    if (options.freeze)
+      dict = WordFrequencyAnalyzer::freeze(dict.get(), report);
 
     ReportWriter::exportReport(report, outFile, dict.get());
 
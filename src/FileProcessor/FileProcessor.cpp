@@ -24,8 +24,10 @@ FileProcessor::FileProcessor(const std::string &filename) {
   std::string line;
   while (std::getline(file, line)) {
     auto tokens = tokenize(line);
-    for (const auto &word : tokens)
+    for (const auto &word : tokens) {
       words.push_back(normalize(word));
+      vocabulary.add(words.back());
+    }
   }
 }
 
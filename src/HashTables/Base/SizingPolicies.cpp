@@ -0,0 +1,102 @@
+#include "HashTables/Base/SizingPolicies.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+namespace {
+
+/**
+ * @brief The sizes of FastPrimeSizing: for each power of two 2^k, the first
+ * primes after 2^k, 1.25 * 2^k, 1.5 * 2^k and 1.75 * 2^k.
+ */
+constexpr size_t PRIMES[] = {
+    5, 7, 11, 13, 17, 23, 29, 37, 41, 53, 59, 67, 83, 97, 113, 131, 163,
+    193, 227, 257, 331, 389, 449, 521, 641, 769, 907, 1031, 1283, 1543,
+    1801, 2053, 2579, 3079, 3593, 4099, 5147, 6151, 7177, 8209, 10243,
+    12289, 14341, 16411, 20483, 24593, 28687, 32771, 40961, 49157, 57347,
+    65537, 81929, 98317, 114689, 131101, 163841, 196613, 229393, 262147,
+    327689, 393241, 458789, 524309, 655373, 786433, 917513, 1048583,
+    1310723, 1572869, 1835017, 2097169, 2621447, 3145739, 3670027, 4194319,
+    5242883, 6291469, 7340033, 8388617, 10485767, 12582917, 14680067,
+    16777259, 20971529, 25165843, 29360147, 33554467, 41943049, 50331653,
+    58720267, 67108879, 83886091, 100663319, 117440551, 134217757,
+    167772161, 201326611, 234881033, 268435459, 335544323, 402653189,
+    469762049, 536870923, 671088667, 805306457, 939524129, 1073741827,
+    1342177283, 1610612741, 1879048201, 2147483659, 2684354591, 3221225473,
+    3758096411, 4294967311, 5368709131, 6442450967, 7516192771, 8589934609,
+    10737418247, 12884901893, 15032385569, 17179869209, 21474836483,
+    25769803799, 30064771081, 34359738421, 42949672979, 51539607599,
+    60129542171, 68719476767, 85899345923, 103079215111, 120259084301,
+    137438953481, 171798691871, 206158430209, 240518168603, 274877906951,
+    343597383697, 412316860441, 481036337167, 549755813911, 687194767367,
+    824633720837, 962072674313, 1099511627791, 1374389534747, 1649267441681,
+    1924145348627, 2199023255579, 2748779069441, 3298534883417,
+    3848290697227, 4398046511119, 5497558138927, 6597069766657,
+    7696581394511, 8796093022237, 10995116277839, 13194139533349,
+    15393162788923, 17592186044423, 21990232555549, 26388279066671,
+    30786325577747, 35184372088891, 43980465111043, 52776558133303,
+    61572651155479, 70368744177679, 87960930222083, 105553116266509,
+    123145302310937, 140737488355333, 175921860444259, 211106232533047,
+    246290604621847};
+
+} // namespace
+
+size_t PrimeSizing::fit(size_t minimum) {
+  auto isPrime = [](size_t x) -> bool {
+    if (x <= 1)
+      return false;
+    if (x == 2 or x == 3)
+      return true;
+    if (x % 2 == 0)
+      return false;
+
+    for (size_t i = 3; i * i <= x; i += 2) {
+      if (x % i == 0)
+        return false;
+    }
+
+    return true;
+  };
+
+  size_t candidate;
+  if (minimum % 2 == 0)
+    candidate = minimum + 1;
+  else
+    candidate = minimum + 2;
+  while (true) {
+    if (isPrime(candidate))
+      return candidate;
+    candidate += 2;
+  }
+}
+
+void PrimeSizing::resize(size_t size) { this->size = size; }
+
+size_t FastPrimeSizing::fit(size_t minimum) {
+  const size_t *prime =
+      std::lower_bound(std::begin(PRIMES), std::end(PRIMES), minimum);
+
+  if (prime == std::end(PRIMES))
+    throw std::length_error("The hash table is too large.");
+
+  return *prime;
+}
+
+void FastPrimeSizing::resize(size_t size) {
+  this->size = size;
+  reciprocal = ~static_cast<unsigned __int128>(0) / size + 1;
+}
+
+size_t PowerOfTwoSizing::fit(size_t minimum) {
+  size_t size = 2;
+
+  while (size < minimum)
+    size *= 2;
+
+  return size;
+}
+
+void PowerOfTwoSizing::resize(size_t size) {
+  shift = 64 - __builtin_ctzll(size);
+}
@@ -0,0 +1,126 @@
+#include "HashTables/Frozen/MinimalPerfectHash.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+size_t MinimalPerfectHash::positionOf(uint64_t code, size_t level,
+                                      size_t words) {
+  // Each level rehashes the code with the splitmix64 finalizer under its own
+  // seed, so codes that collided at one level spread out at the next.
+  uint64_t h = code + (level + 1) * 0x9e3779b97f4a7c15ULL;
+  h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+  h ^= h >> 31;
+
+  return h % (words * 64);
+}
+
+size_t MinimalPerfectHash::rank(size_t bit) const {
+  size_t word = bit / 64;
+  size_t count = ranks[word / WORDS_PER_RANK];
+
+  for (size_t w = word - word % WORDS_PER_RANK; w < word; w++)
+    count += __builtin_popcountll(bits[w]);
+
+  return count + __builtin_popcountll(bits[word] &
+                                      ((uint64_t(1) << (bit % 64)) - 1));
+}
+
+MinimalPerfectHash::MinimalPerfectHash() : levelOffsets{0}, codesCount(0) {}
+
+MinimalPerfectHash::MinimalPerfectHash(const std::vector<uint64_t> &codes,
+                                       double gamma)
+    : levelOffsets{0}, codesCount(codes.size()) {
+  if (gamma < 1)
+    throw std::invalid_argument("The level size ratio must be at least one.");
+
+  std::vector<uint64_t> remaining = codes;
+
+  std::sort(remaining.begin(), remaining.end());
+  if (std::adjacent_find(remaining.begin(), remaining.end()) != remaining.end())
+    throw std::invalid_argument("Perfect hashing requires distinct codes.");
+
+  for (size_t level = 0; level < MAX_LEVELS and !remaining.empty(); level++) {
+    size_t words = static_cast<size_t>(
+        std::ceil(gamma * remaining.size() / 64.0));
+    std::vector<uint64_t> taken(words, 0), collided(words, 0);
+
+    for (uint64_t code : remaining) {
+      size_t pos = positionOf(code, level, words);
+      uint64_t mask = uint64_t(1) << (pos % 64);
+
+      if (taken[pos / 64] & mask)
+        collided[pos / 64] |= mask;
+      else
+        taken[pos / 64] |= mask;
+    }
+
+    std::vector<uint64_t> next;
+
+    for (uint64_t code : remaining) {
+      size_t pos = positionOf(code, level, words);
+
+      if (collided[pos / 64] & (uint64_t(1) << (pos % 64)))
+        next.push_back(code);
+    }
+
+    for (size_t w = 0; w < words; w++)
+      bits.push_back(taken[w] & ~collided[w]);
+
+    levelOffsets.push_back(bits.size());
+    remaining = std::move(next);
+  }
+
+  size_t placed = 0;
+
+  for (size_t w = 0; w < bits.size(); w++) {
+    if (w % WORDS_PER_RANK == 0)
+      ranks.push_back(static_cast<uint32_t>(placed));
+
+    placed += __builtin_popcountll(bits[w]);
+  }
+
+  bits.shrink_to_fit();
+  ranks.shrink_to_fit();
+
+  for (uint64_t code : remaining)
+    fallback.emplace(code, placed++);
+}
+
+size_t MinimalPerfectHash::operator()(uint64_t code) const {
+  for (size_t level = 0; level + 1 < levelOffsets.size(); level++) {
+    size_t words = levelOffsets[level + 1] - levelOffsets[level];
+    size_t bit = levelOffsets[level] * 64 + positionOf(code, level, words);
+
+    if (bits[bit / 64] & (uint64_t(1) << (bit % 64)))
+      return rank(bit);
+  }
+
+  auto it = fallback.find(code);
+  return it == fallback.end() ? codesCount : it->second;
+}
+
+size_t MinimalPerfectHash::size() const { return codesCount; }
+
+size_t MinimalPerfectHash::getLevelsCount() const {
+  return levelOffsets.size() - 1;
+}
+
+size_t MinimalPerfectHash::getFallbackCount() const { return fallback.size(); }
+
+size_t MinimalPerfectHash::getMemoryUsage() const {
+  // Each fallback entry is a hash node holding the pair and a next pointer.
+  size_t fallbackNode = sizeof(std::pair<const uint64_t, size_t>) +
+                        sizeof(void *);
+
+  return bits.capacity() * sizeof(uint64_t) +
+         ranks.capacity() * sizeof(uint32_t) +
+         levelOffsets.capacity() * sizeof(size_t) +
+         fallback.size() * fallbackNode +
+         fallback.bucket_count() * sizeof(void *);
+}
+
+double MinimalPerfectHash::getBitsPerKey() const {
+  return codesCount ? 8.0 * getMemoryUsage() / codesCount : 0;
+}
@@ -23,6 +23,9 @@ void ReportWriter::exportReport(const ReportData &reportData, std::ostream &out,
   out << "Estrutura de Dados: " << reportData.dictionaryType << '\n';
   out << "Data de execução: " << Timer::getCurrentDateTime() << '\n';
   out << "Quantidade de palavras: " << reportData.totalWordsProcessed << '\n';
+  out << "Vocabulário estimado (HyperLogLog): "
+      << reportData.estimatedVocabulary << " (erro padrão de "
+      << std::round(reportData.vocabularyStandardError * 1000) / 10 << "%)\n";
 
   out << std::endl;
 
@@ -39,4 +42,45 @@ void ReportWriter::exportReport(const ReportData &reportData, std::ostream &out,
   out << "Número de " << reportData.specificMetric.first << ": "
       << reportData.specificMetric.second << '\n'
       << "Tamanho da estrutura (kB): " << reportData.memoryUsage;
+
+  if (reportData.errorBounds)
+    out << "\nErro relativo (ε): " << reportData.errorBounds->epsilon
+        << "\nProbabilidade de falha (δ): " << reportData.errorBounds->delta
+        << "\nSuperestimativa máxima: "
+        << reportData.errorBounds->maxOverestimate;
+
+  if (reportData.lockContention)
+    out << "\nAquisições de locks: "
+        << reportData.lockContention->acquisitions
+        << "\nAquisições com espera: "
+        << reportData.lockContention->contendedAcquisitions
+        << "\nTempo de espera por locks (ms): "
+        << reportData.lockContention->waitTime.count() / 1e6;
+
+  if (reportData.probeStatistics) {
+    double lookups = reportData.probeStatistics->lookups;
+
+    out << "\nBuscas: " << reportData.probeStatistics->lookups
+        << "\nSondagens por busca: "
+        << (lookups ? reportData.probeStatistics->probes / lookups : 0)
+        << "\nLinhas de cache por busca (estimativa de falhas): "
+        << (lookups ? reportData.probeStatistics->cacheLines / lookups : 0);
+  }
+
+  if (reportData.parallelMerge)
+    out << "\nDicionários locais: " << reportData.parallelMerge->dictionaries
+        << " (fusão em " << reportData.parallelMerge->levels << " níveis)"
+        << "\nComparações nas threads: "
+        << reportData.parallelMerge->workerComparisons
+        << "\nComparações na fusão: "
+        << reportData.parallelMerge->mergeComparisons << "\nNúmero de "
+        << reportData.specificMetric.first << " nas threads: "
+        << reportData.parallelMerge->workerSpecificMetric << "\nNúmero de "
+        << reportData.specificMetric.first << " na fusão: "
+        << reportData.parallelMerge->mergeSpecificMetric
+        << "\nTempo de fusão (ms): "
+        << reportData.parallelMerge->mergeTime.count();
+
+  for (const auto &[name, value] : reportData.additionalMetrics)
+    out << '\n' << name << ": " << value;
 }
\ No newline at end of file
@@ -0,0 +1,338 @@
+#include "Utils/Hashing/StringHash.hpp"
+
+#include <array>
+#include <cstring>
+#include <functional>
+#include <stdexcept>
+#include <string_view>
+
+#if defined(__x86_64__)
+#include <nmmintrin.h>
+#endif
+
+namespace {
+uint64_t read64(const char *p) {
+  uint64_t value;
+  std::memcpy(&value, p, sizeof(value));
+  return value;
+}
+
+uint64_t read32(const char *p) {
+  uint32_t value;
+  std::memcpy(&value, p, sizeof(value));
+  return value;
+}
+
+uint64_t byte(const char *p) { return static_cast<unsigned char>(*p); }
+
+/**
+ * @brief Replaces `a` and `b` by the low and high halves of their 128-bit
+ * product.
+ */
+constexpr void multiply128(uint64_t &a, uint64_t &b) {
+  unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+  a = static_cast<uint64_t>(product);
+  b = static_cast<uint64_t>(product >> 64);
+}
+
+/**
+ * @brief Returns the two halves of the 128-bit product of `a` and `b`,
+ * XORed together.
+ */
+constexpr uint64_t fold128(uint64_t a, uint64_t b) {
+  multiply128(a, b);
+  return a ^ b;
+}
+
+// wyhash, final version 4, with the default secret and a seed of zero.
+
+constexpr uint64_t WY_SECRET[4] = {0x2d358dccaa6c78a5ULL, 0x8bb84b93962eacc9ULL,
+                                   0x4b33a62ed433d4a3ULL,
+                                   0x4d5a2da51de1aa47ULL};
+
+constexpr uint64_t WY_SEED = fold128(WY_SECRET[0], WY_SECRET[1]);
+
+// The XXH3-like hash.
+
+constexpr uint64_t PRIME64_1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr uint64_t PRIME64_3 = 0x165667B19E3779F9ULL;
+
+/**
+ * @brief The secret of the XXH3-like hash: 16 words drawn from SplitMix64.
+ */
+constexpr std::array<uint64_t, 16> makeSecret() {
+  std::array<uint64_t, 16> secret{};
+  uint64_t state = PRIME64_1;
+
+  for (uint64_t &word : secret) {
+    state += 0x9E3779B97F4A7C15ULL;
+    uint64_t z = state;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    word = z ^ (z >> 31);
+  }
+
+  return secret;
+}
+
+constexpr std::array<uint64_t, 16> XXH_SECRET = makeSecret();
+
+uint64_t xxh64Avalanche(uint64_t h) {
+  h ^= h >> 33;
+  h *= PRIME64_2;
+  h ^= h >> 29;
+  h *= PRIME64_3;
+  return h ^ (h >> 32);
+}
+
+uint64_t xxh3Avalanche(uint64_t h) {
+  h ^= h >> 37;
+  h *= 0x165667919E3779F9ULL;
+  return h ^ (h >> 32);
+}
+
+uint64_t rotateLeft(uint64_t x, unsigned bits) {
+  return (x << bits) | (x >> (64 - bits));
+}
+
+/**
+ * @brief Folds the 16 bytes at `p`, keyed by the pair of secret words
+ * `pair`, into 64 bits.
+ */
+uint64_t mix16(const char *p, size_t pair) {
+  return fold128(read64(p) ^ XXH_SECRET[2 * pair],
+                 read64(p + 8) ^ XXH_SECRET[2 * pair + 1]);
+}
+
+// CRC-32C.
+
+constexpr uint32_t CRC32C_POLYNOMIAL = 0x82F63B78; // reflected 0x1EDC6F41
+
+constexpr std::array<uint32_t, 256> makeCrc32cTable() {
+  std::array<uint32_t, 256> table{};
+
+  for (uint32_t i = 0; i < 256; i++) {
+    uint32_t crc = i;
+    for (int bit = 0; bit < 8; bit++)
+      crc = (crc >> 1) ^ (crc & 1 ? CRC32C_POLYNOMIAL : 0);
+    table[i] = crc;
+  }
+
+  return table;
+}
+
+constexpr std::array<uint32_t, 256> CRC32C_TABLE = makeCrc32cTable();
+
+/**
+ * @brief Spreads a 32-bit checksum over 64 bits, so that the high bits of
+ * the code, which Fibonacci hashing and the fingerprints of the open
+ * addressing table use, are not all zero.
+ */
+uint64_t spread(uint32_t crc) { return crc * 0x9E3779B97F4A7C15ULL; }
+
+uint64_t crc32cSoftware(const char *data, size_t length) {
+  uint32_t crc = 0xFFFFFFFF;
+
+  for (size_t i = 0; i < length; i++)
+    crc = (crc >> 8) ^ CRC32C_TABLE[(crc ^ byte(data + i)) & 0xFF];
+
+  return spread(~crc);
+}
+
+#if defined(__x86_64__)
+__attribute__((target("sse4.2"))) uint64_t
+crc32cHardware(const char *data, size_t length) {
+  uint64_t crc = 0xFFFFFFFF;
+
+  for (; length >= 8; data += 8, length -= 8)
+    crc = _mm_crc32_u64(crc, read64(data));
+
+  // The tail is taken 4, 2 and 1 bytes at a time: a word is mostly tail.
+  uint32_t crc32 = static_cast<uint32_t>(crc);
+  if (length & 4) {
+    crc32 = _mm_crc32_u32(crc32, static_cast<uint32_t>(read32(data)));
+    data += 4;
+  }
+  if (length & 2) {
+    uint16_t pair;
+    std::memcpy(&pair, data, sizeof(pair));
+    crc32 = _mm_crc32_u16(crc32, pair);
+    data += 2;
+  }
+  if (length & 1)
+    crc32 = _mm_crc32_u8(crc32, static_cast<unsigned char>(*data));
+
+  return spread(~crc32);
+}
+#endif
+} // namespace
+
+namespace StringHash {
+uint64_t standard(const char *data, size_t length) {
+  return std::hash<std::string_view>{}(std::string_view(data, length));
+}
+
+uint64_t wyhash(const char *data, size_t length) {
+  uint64_t seed = WY_SEED, a, b;
+
+  if (length <= 16) {
+    if (length >= 4) {
+      size_t middle = (length >> 3) << 2;
+      a = (read32(data) << 32) | read32(data + middle);
+      b = (read32(data + length - 4) << 32) |
+          read32(data + length - 4 - middle);
+    } else if (length > 0) {
+      a = (byte(data) << 16) | (byte(data + (length >> 1)) << 8) |
+          byte(data + length - 1);
+      b = 0;
+    } else {
+      a = b = 0;
+    }
+  } else {
+    const char *p = data;
+    size_t left = length;
+
+    if (left > 48) {
+      uint64_t seed1 = seed, seed2 = seed;
+      do {
+        seed = fold128(read64(p) ^ WY_SECRET[1], read64(p + 8) ^ seed);
+        seed1 = fold128(read64(p + 16) ^ WY_SECRET[2], read64(p + 24) ^ seed1);
+        seed2 = fold128(read64(p + 32) ^ WY_SECRET[3], read64(p + 40) ^ seed2);
+        p += 48;
+        left -= 48;
+      } while (left > 48);
+      seed ^= seed1 ^ seed2;
+    }
+
+    while (left > 16) {
+      seed = fold128(read64(p) ^ WY_SECRET[1], read64(p + 8) ^ seed);
+      p += 16;
+      left -= 16;
+    }
+
+    a = read64(p + left - 16);
+    b = read64(p + left - 8);
+  }
+
+  a ^= WY_SECRET[1];
+  b ^= seed;
+  multiply128(a, b);
+  return fold128(a ^ WY_SECRET[0] ^ length, b ^ WY_SECRET[1]);
+}
+
+uint64_t xxh3(const char *data, size_t length) {
+  if (length == 0)
+    return xxh64Avalanche(XXH_SECRET[0] ^ XXH_SECRET[1]);
+
+  if (length <= 3) {
+    uint64_t combined = (byte(data) << 16) |
+                        (byte(data + (length >> 1)) << 24) |
+                        byte(data + length - 1) | (length << 8);
+    return xxh64Avalanche(combined ^ (XXH_SECRET[0] >> 32));
+  }
+
+  if (length <= 8) {
+    uint64_t input = read32(data + length - 4) + (read32(data) << 32);
+    uint64_t h = input ^ XXH_SECRET[1];
+
+    // rrmxmx, XXH3's mixer for 4 to 8 bytes.
+    h ^= rotateLeft(h, 49) ^ rotateLeft(h, 24);
+    h *= 0x9FB21C651E98DF25ULL;
+    h ^= (h >> 35) + length;
+    h *= 0x9FB21C651E98DF25ULL;
+    return h ^ (h >> 28);
+  }
+
+  if (length <= 16) {
+    uint64_t low = read64(data) ^ XXH_SECRET[2];
+    uint64_t high = read64(data + length - 8) ^ XXH_SECRET[3];
+    uint64_t acc =
+        length + __builtin_bswap64(low) + high + fold128(low, high);
+    return xxh3Avalanche(acc);
+  }
+
+  uint64_t acc = length * PRIME64_1;
+
+  if (length <= 128) {
+    // Stripes taken from both ends, as in XXH3.
+    if (length > 32) {
+      if (length > 64) {
+        if (length > 96) {
+          acc += mix16(data + 48, 6);
+          acc += mix16(data + length - 64, 7);
+        }
+        acc += mix16(data + 32, 4);
+        acc += mix16(data + length - 48, 5);
+      }
+      acc += mix16(data + 16, 2);
+      acc += mix16(data + length - 32, 3);
+    }
+    acc += mix16(data, 0);
+    acc += mix16(data + length - 16, 1);
+    return xxh3Avalanche(acc);
+  }
+
+  size_t stripes = length / 16;
+  for (size_t i = 0; i < stripes; i++)
+    acc += mix16(data + 16 * i, i % 8);
+  acc += mix16(data + length - 16, 7);
+
+  return xxh3Avalanche(acc);
+}
+
+bool hasHardwareCrc32c() {
+#if defined(__x86_64__)
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("sse4.2");
+#else
+  return false;
+#endif
+}
+
+uint64_t crc32c(const char *data, size_t length) {
+  return get(StringHashFunction::CRC32C)(data, length);
+}
+
+Function get(StringHashFunction function) {
+  switch (function) {
+  case StringHashFunction::WyHash:
+    return wyhash;
+  case StringHashFunction::XXH3:
+    return xxh3;
+  case StringHashFunction::CRC32C:
+#if defined(__x86_64__)
+    if (hasHardwareCrc32c())
+      return crc32cHardware;
+#endif
+    return crc32cSoftware;
+  default:
+    return standard;
+  }
+}
+
+void select(StringHashFunction function) { selectedFunction = get(function); }
+
+std::string name(StringHashFunction function) {
+  switch (function) {
+  case StringHashFunction::WyHash:
+    return "wyhash";
+  case StringHashFunction::XXH3:
+    return "xxh3";
+  case StringHashFunction::CRC32C:
+    return "crc32c";
+  default:
+    return "std";
+  }
+}
+
+StringHashFunction fromName(const std::string &name) {
+  for (StringHashFunction function :
+       {StringHashFunction::Std, StringHashFunction::WyHash,
+        StringHashFunction::XXH3, StringHashFunction::CRC32C})
+    if (StringHash::name(function) == name)
+      return function;
+
+  throw std::invalid_argument("Unknown hash function: " + name);
+}
+} // namespace StringHash
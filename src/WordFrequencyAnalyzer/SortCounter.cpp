@@ -0,0 +1,121 @@
+#include "WordFrequencyAnalyzer/SortCounter.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+size_t SortCounter::digit(std::string_view word, size_t depth) {
+  return depth < word.size() ? static_cast<unsigned char>(word[depth]) + 1 : 0;
+}
+
+void SortCounter::radixSort(std::string_view *words, std::string_view *buffer,
+                            size_t n, size_t depth) {
+  if (n < INSERTION_THRESHOLD) {
+    for (size_t i = 1; i < n; i++) {
+      std::string_view word = words[i];
+      size_t j = i;
+
+      for (; j > 0 and word.substr(depth) < words[j - 1].substr(depth); j--)
+        words[j] = words[j - 1];
+
+      words[j] = word;
+    }
+    return;
+  }
+
+  size_t starts[258] = {};
+
+  for (size_t i = 0; i < n; i++)
+    starts[digit(words[i], depth) + 1]++;
+
+  for (size_t d = 1; d < 258; d++)
+    starts[d] += starts[d - 1];
+
+  size_t next[257];
+  std::copy(starts, starts + 257, next);
+
+  for (size_t i = 0; i < n; i++)
+    buffer[next[digit(words[i], depth)]++] = words[i];
+
+  std::copy(buffer, buffer + n, words);
+
+  // Words that ended (digit zero) are all equal; every other bucket shares
+  // one more byte.
+  for (size_t d = 1; d < 257; d++)
+    if (starts[d + 1] - starts[d] > 1)
+      radixSort(words + starts[d], buffer + starts[d],
+                starts[d + 1] - starts[d], depth + 1);
+}
+
+SortCounter::Run
+SortCounter::encode(const std::vector<std::string_view> &sorted) {
+  Run run;
+
+  for (std::string_view word : sorted) {
+    if (!run.empty() and run.back().first == word)
+      run.back().second++;
+    else
+      run.emplace_back(word, 1);
+  }
+
+  return run;
+}
+
+SortCounter::Run SortCounter::merge(const Run &a, const Run &b) {
+  Run merged;
+  merged.reserve(a.size() + b.size());
+
+  size_t i = 0, j = 0;
+
+  while (i < a.size() and j < b.size()) {
+    int order = a[i].first.compare(b[j].first);
+
+    if (order < 0) {
+      merged.push_back(a[i++]);
+    } else if (order > 0) {
+      merged.push_back(b[j++]);
+    } else {
+      merged.emplace_back(a[i].first, a[i].second + b[j].second);
+      i++;
+      j++;
+    }
+  }
+
+  merged.insert(merged.end(), a.begin() + i, a.end());
+  merged.insert(merged.end(), b.begin() + j, b.end());
+
+  return merged;
+}
+
+SortCounter::Run SortCounter::count(const std::vector<std::string> &words,
+                                    size_t blockSize) {
+  if (blockSize == 0)
+    throw std::invalid_argument("Sort counting requires a positive block size.");
+
+  std::vector<Run> runs;
+  std::vector<std::string_view> block, buffer;
+
+  for (size_t begin = 0; begin < words.size(); begin += blockSize) {
+    size_t end = std::min(words.size(), begin + blockSize);
+
+    block.assign(words.begin() + begin, words.begin() + end);
+    buffer.resize(block.size());
+    radixSort(block.data(), buffer.data(), block.size(), 0);
+
+    runs.push_back(encode(block));
+  }
+
+  // Merging neighbours level by level reads every count O(log runs) times.
+  while (runs.size() > 1) {
+    std::vector<Run> merged;
+
+    for (size_t i = 0; i + 1 < runs.size(); i += 2)
+      merged.push_back(merge(runs[i], runs[i + 1]));
+
+    if (runs.size() % 2 == 1)
+      merged.push_back(std::move(runs.back()));
+
+    runs = std::move(merged);
+  }
+
+  return runs.empty() ? Run() : std::move(runs.front());
+}
@@ -1,14 +1,32 @@
 #include "WordFrequencyAnalyzer/WordFrequencyAnalyzer.hpp"
 
+#include <chrono>
 #include <cmath>
+#include <thread>
+#include <utility>
 
+#include "Factory/DictionaryFactory.hpp"
+#include "HashTables/Frozen/FrozenHashTable.hpp"
 #include "Utils/Strings/StringHandler.hpp"
+#include "WordFrequencyAnalyzer/SortCounter.hpp"
 #include "Utils/Timer/Timer.hpp"
 #include "Visitor/ReportDataCollectorVisitor.hpp"
 
+ReportData WordFrequencyAnalyzer::countersOf(
+    const IDictionary<LexicalStr, size_t> *dictionary) {
+  ReportData data;
+  ReportDataCollectorVisitor<LexicalStr, size_t> visitor(data);
+  dictionary->accept(visitor);
+
+  return data;
+}
+
 ReportData
 WordFrequencyAnalyzer::analyze(IDictionary<LexicalStr, size_t> *dictionary,
-                               const FileProcessor &fileProcessor) {
+                               const FileProcessor &fileProcessor,
+                               size_t threads, CountingEngine engine,
+                               std::optional<DictionaryType> dictType,
+                               bool measureLatency) {
   ReportData report;
 
   Timer timer;
@@ -16,21 +34,274 @@ WordFrequencyAnalyzer::analyze(IDictionary<LexicalStr, size_t> *dictionary,
 
   long wordsCount = 0;
   report.maxKeyLength = 0;
-  for (const std::string &word : fileProcessor.words) {
-    (*dictionary)[word]++;
-    wordsCount++;
-    report.maxKeyLength =
-        std::max(report.maxKeyLength, StringHandler::size(word));
+
+  if (engine == CountingEngine::Sort) {
+    const std::vector<std::string> &words = fileProcessor.words;
+    SortCounter::Run counts = SortCounter::count(words);
+
+    dictionary->reserve(counts.size());
+
+    for (const auto &[word, count] : counts) {
+      std::string key(word);
+      dictionary->increment(key, count);
+      report.maxKeyLength =
+          std::max(report.maxKeyLength, StringHandler::size(key));
+    }
+
+    wordsCount = words.size();
+
+    size_t blocks = (words.size() + SortCounter::DEFAULT_BLOCK_SIZE - 1) /
+                    SortCounter::DEFAULT_BLOCK_SIZE;
+    report.additionalMetrics.emplace_back(
+        "Contagem por ordenação",
+        std::to_string(blocks) + " blocos de até " +
+            std::to_string(SortCounter::DEFAULT_BLOCK_SIZE) + " palavras");
+  } else if (threads > 1 and dictionary->isThreadSafe()) {
+    const std::vector<std::string> &words = fileProcessor.words;
+    std::vector<size_t> maxKeyLengths(threads, 0);
+    std::vector<std::thread> workers;
+
+    for (size_t t = 0; t < threads; t++) {
+      size_t begin = words.size() * t / threads,
+             end = words.size() * (t + 1) / threads;
+
+      workers.emplace_back([&, t, begin, end]() {
+        size_t maxKeyLength = 0;
+
+        for (size_t i = begin; i < end; i++) {
+          dictionary->increment(words[i], 1);
+          maxKeyLength = std::max(maxKeyLength, StringHandler::size(words[i]));
+        }
+
+        maxKeyLengths[t] = maxKeyLength;
+      });
+    }
+
+    for (std::thread &worker : workers)
+      worker.join();
+
+    wordsCount = words.size();
+    for (size_t length : maxKeyLengths)
+      report.maxKeyLength = std::max(report.maxKeyLength, length);
+  } else if (threads > 1 and dictType and
+             *dictType != DictionaryType::CountMinSketch and
+             *dictType != DictionaryType::SpaceSaving) {
+    const std::vector<std::string> &words = fileProcessor.words;
+    std::vector<std::unique_ptr<IDictionary<LexicalStr, size_t>>> owned;
+    std::vector<IDictionary<LexicalStr, size_t> *> partials{dictionary};
+    std::vector<size_t> maxKeyLengths(threads, 0);
+    std::vector<std::thread> workers;
+
+    for (size_t t = 1; t < threads; t++) {
+      owned.push_back(DictionaryFactory<LexicalStr, size_t>::createDictionary(
+          *dictType, fileProcessor.vocabulary.upperBound()));
+      partials.push_back(owned.back().get());
+    }
+
+    for (size_t t = 0; t < threads; t++) {
+      size_t begin = words.size() * t / threads,
+             end = words.size() * (t + 1) / threads;
+
+      workers.emplace_back([&, t, begin, end]() {
+        size_t maxKeyLength = 0;
+
+        for (size_t i = begin; i < end; i++) {
+          partials[t]->increment(words[i], 1);
+          maxKeyLength = std::max(maxKeyLength, StringHandler::size(words[i]));
+        }
+
+        maxKeyLengths[t] = maxKeyLength;
+      });
+    }
+
+    for (std::thread &worker : workers)
+      worker.join();
+
+    ParallelMerge merge{threads, 0, 0, 0, 0, 0, std::chrono::milliseconds(0),
+                        std::nullopt};
+
+    // Adds the lookups a dictionary made between two of its reports.
+    auto addProbes = [&merge](const ReportData &now, const ReportData &base) {
+      if (!now.probeStatistics)
+        return;
+
+      ProbeStatistics start =
+          base.probeStatistics.value_or(ProbeStatistics{0, 0, 0});
+      if (!merge.probeStatistics)
+        merge.probeStatistics = ProbeStatistics{0, 0, 0};
+
+      merge.probeStatistics->lookups +=
+          now.probeStatistics->lookups - start.lookups;
+      merge.probeStatistics->probes +=
+          now.probeStatistics->probes - start.probes;
+      merge.probeStatistics->cacheLines +=
+          now.probeStatistics->cacheLines - start.cacheLines;
+    };
+
+    for (const auto *partial : partials) {
+      ReportData counters = countersOf(partial);
+      merge.workerComparisons += counters.comparisons;
+      merge.workerSpecificMetric += counters.specificMetric.second;
+      addProbes(counters, ReportData{});
+    }
+
+    std::chrono::steady_clock::duration mergeTime(0);
+
+    // Level by level, each dictionary absorbs its neighbour `step` away,
+    // which it may empty. The cost of a level is therefore read from the
+    // absorbing dictionaries alone, before and after it, outside the timing.
+    for (size_t step = 1; step < threads; step *= 2, merge.levels++) {
+      std::vector<size_t> absorbing;
+      std::vector<ReportData> before;
+
+      for (size_t i = 0; i + step < threads; i += 2 * step) {
+        absorbing.push_back(i);
+        before.push_back(countersOf(partials[i]));
+      }
+
+      auto start = std::chrono::steady_clock::now();
+      std::vector<std::thread> mergers;
+
+      for (size_t i : absorbing)
+        mergers.emplace_back([&, i, step]() {
+          partials[i]->mergeFrom(std::move(*partials[i + step]));
+        });
+
+      for (std::thread &merger : mergers)
+        merger.join();
+
+      mergeTime += std::chrono::steady_clock::now() - start;
+
+      for (size_t k = 0; k < absorbing.size(); k++) {
+        ReportData after = countersOf(partials[absorbing[k]]);
+        merge.mergeComparisons += after.comparisons - before[k].comparisons;
+        merge.mergeSpecificMetric +=
+            after.specificMetric.second - before[k].specificMetric.second;
+        addProbes(after, before[k]);
+      }
+    }
+
+    merge.mergeTime =
+        std::chrono::duration_cast<std::chrono::milliseconds>(mergeTime);
+
+    report.parallelMerge = merge;
+
+    wordsCount = words.size();
+    for (size_t length : maxKeyLengths)
+      report.maxKeyLength = std::max(report.maxKeyLength, length);
+  } else if (measureLatency) {
+    std::chrono::steady_clock::duration maxLatency(0);
+
+    for (const std::string &word : fileProcessor.words) {
+      auto start = std::chrono::steady_clock::now();
+      dictionary->increment(word, 1);
+      maxLatency =
+          std::max(maxLatency, std::chrono::steady_clock::now() - start);
+
+      wordsCount++;
+      report.maxKeyLength =
+          std::max(report.maxKeyLength, StringHandler::size(word));
+    }
+
+    report.additionalMetrics.emplace_back(
+        "Latência máxima por operação (ns)",
+        std::to_string(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(maxLatency)
+                .count()));
+  } else {
+    for (const std::string &word : fileProcessor.words) {
+      dictionary->increment(word, 1);
+      wordsCount++;
+      report.maxKeyLength =
+          std::max(report.maxKeyLength, StringHandler::size(word));
+    }
   }
 
   timer.stop();
 
   ReportDataCollectorVisitor<LexicalStr, size_t> visitor(report);
   dictionary->accept(visitor);
+
+  if (report.parallelMerge) {
+    report.comparisons = report.parallelMerge->workerComparisons +
+                         report.parallelMerge->mergeComparisons;
+    report.specificMetric.second = report.parallelMerge->workerSpecificMetric +
+                                   report.parallelMerge->mergeSpecificMetric;
+    if (report.parallelMerge->probeStatistics)
+      report.probeStatistics = report.parallelMerge->probeStatistics;
+  }
+
   report.buildTime = timer.duration();
   report.totalWordsProcessed = wordsCount;
+  report.estimatedVocabulary = fileProcessor.vocabulary.estimate();
+  report.vocabularyStandardError =
+      fileProcessor.vocabulary.getStandardError();
   report.filename = fileProcessor.path;
   report.memoryUsage = dictionary->getMemoryUsage() / 1024.0f;
 
   return report;
+}
+
+std::unique_ptr<IDictionary<LexicalStr, size_t>>
+WordFrequencyAnalyzer::freeze(const IDictionary<LexicalStr, size_t> *dictionary,
+                              ReportData &report) {
+  Timer timer;
+  timer.start();
+
+  auto frozen = std::make_unique<FrozenHashTable<LexicalStr, size_t>>(
+      *dictionary);
+
+  timer.stop();
+
+  report.additionalMetrics.emplace_back(
+      "Congelamento (ms)", std::to_string(timer.duration().count()));
+  report.additionalMetrics.emplace_back(
+      "Tabela congelada (kB)",
+      StringHandler::toString(frozen->getMemoryUsage() / 1024.0f));
+  report.additionalMetrics.emplace_back(
+      "Bits por chave (hash perfeito)",
+      StringHandler::toString(frozen->getBitsPerKey()));
+  report.additionalMetrics.emplace_back(
+      "Chaves com código de hash repetido",
+      std::to_string(frozen->getSharedCodesCount()));
+
+  return frozen;
+}
+
+void WordFrequencyAnalyzer::measureHashing(const FileProcessor &fileProcessor,
+                                           StringHashFunction function,
+                                           ReportData &report) {
+  const std::vector<std::string> &words = fileProcessor.words;
+  StringHash::Function hash = StringHash::get(function);
+
+  // The codes are XORed together and stored, so that the calls cannot be
+  // optimized out.
+  uint64_t codes = 0;
+  size_t hashes = 0;
+  std::chrono::nanoseconds elapsed(0);
+
+  while (!words.empty() and elapsed < MIN_HASHING_TIME) {
+    auto begin = std::chrono::steady_clock::now();
+
+    for (const std::string &word : words)
+      codes ^= hash(word.data(), word.size());
+
+    elapsed += std::chrono::steady_clock::now() - begin;
+    hashes += words.size();
+  }
+
+  volatile uint64_t sink = codes;
+  (void)sink;
+
+  std::string name = StringHash::name(function);
+  if (function == StringHashFunction::CRC32C and
+      !StringHash::hasHardwareCrc32c())
+    name += " (sem SSE4.2, por tabela)";
+
+  report.additionalMetrics.emplace_back("Função de hash", name);
+  report.additionalMetrics.emplace_back(
+      "Tempo por hash (ns)",
+      StringHandler::toString(hashes ? static_cast<double>(elapsed.count()) /
+                                           hashes
+                                     : 0.0));
 }
\ No newline at end of file
@@ -0,0 +1,111 @@
+/**
+ * @file MergeTests.cpp
+ * @brief Checks IDictionary::mergeFrom when a dictionary is merged into
+ * itself and when an incremental rehash is in progress.
+ *
+ * Each check prints its name and result; the program exits with 1 if any
+ * of them fails.
+ */
+
+#include <iostream>
+#include <string>
+
+#include "HashTables/Chained/ChainedHashTable.hpp"
+#include "HashTables/OpenAddressing/OpenAddressingHashTable.hpp"
+#include "Trees/Splay/SplayTree.hpp"
+
+namespace {
+const size_t KEYS = 1000;
+
+size_t failures = 0;
+
+void check(bool passed, const std::string &name) {
+  std::cout << (passed ? "ok      " : "FALHOU  ") << name << '\n';
+  if (!passed)
+    failures++;
+}
+
+std::string keyOf(size_t i) { return "chave" + std::to_string(i); }
+
+/**
+ * @brief Counts key i with the value i + 1.
+ */
+void fill(IDictionary<std::string, size_t> &dictionary, size_t first,
+          size_t last) {
+  for (size_t i = first; i < last; i++)
+    dictionary.increment(keyOf(i), i + 1);
+}
+
+/**
+ * @brief Tells whether key i holds `factor` times i + 1 for every i in
+ * [first, last), and whether no other key is present.
+ */
+bool holds(const IDictionary<std::string, size_t> &dictionary, size_t first,
+           size_t last, size_t factor) {
+  size_t keys = 0;
+  bool correct = true;
+
+  dictionary.forEach([&keys](const std::string &, const size_t &) { keys++; });
+
+  for (size_t i = first; i < last; i++) {
+    size_t value = 0;
+    if (!dictionary.find(keyOf(i), value) or value != factor * (i + 1))
+      correct = false;
+  }
+
+  return correct and keys == last - first;
+}
+
+template <typename Dictionary> void selfMerge(const std::string &name) {
+  Dictionary dictionary;
+  fill(dictionary, 0, KEYS);
+  dictionary.mergeFrom(dictionary);
+  check(holds(dictionary, 0, KEYS, 2), name + ": fusão consigo mesmo");
+}
+
+template <typename Dictionary>
+void selfMergeWhileRehashing(const std::string &name) {
+  Dictionary dictionary;
+  fill(dictionary, 0, KEYS);
+  dictionary.reserve(5 * KEYS);
+  dictionary.mergeFrom(dictionary);
+  check(holds(dictionary, 0, KEYS, 2),
+        name + ": fusão consigo mesmo durante um rehash");
+}
+
+template <typename Dictionary>
+void mergeWhileRehashing(const std::string &name) {
+  Dictionary target, source;
+  fill(target, 0, KEYS);
+  fill(source, KEYS / 2, KEYS + KEYS / 2);
+  target.reserve(5 * KEYS);
+  source.reserve(5 * KEYS);
+  target.mergeFrom(source);
+
+  bool correct = holds(source, KEYS / 2, KEYS + KEYS / 2, 1);
+  for (size_t i = 0; i < KEYS + KEYS / 2; i++) {
+    size_t value = 0, shared = i >= KEYS / 2 and i < KEYS ? 2 : 1;
+    if (!target.find(keyOf(i), value) or value != shared * (i + 1))
+      correct = false;
+  }
+
+  check(correct, name + ": fusão com as duas tabelas em rehash");
+}
+} // namespace
+
+int main() {
+  using Chained = ChainedHashTable<std::string, size_t>;
+  using OpenAddressing = OpenAddressingHashTable<std::string, size_t>;
+
+  selfMerge<Chained>("encadeamento");
+  selfMerge<OpenAddressing>("endereçamento aberto");
+  selfMerge<SplayTree<std::string, size_t>>("árvore splay");
+
+  selfMergeWhileRehashing<Chained>("encadeamento");
+  selfMergeWhileRehashing<OpenAddressing>("endereçamento aberto");
+
+  mergeWhileRehashing<Chained>("encadeamento");
+  mergeWhileRehashing<OpenAddressing>("endereçamento aberto");
+
+  return failures ? 1 : 0;
+}